@@ -0,0 +1,422 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	yaipbench.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	End to end benchmark of YAIP on generated INI files
+ */
+#include "YAIP.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+/**
+ * Shape of the generated INI file and benchmark settings
+ */
+struct BenchConfig
+{
+	/**
+	 * Number of sections
+	 */
+	size_t Sections = 1000;
+
+	/**
+	 * Number of keys per section
+	 */
+	size_t Keys = 20;
+
+	/**
+	 * Length of each value
+	 */
+	size_t ValueLength = 16;
+
+	/**
+	 * Percentage of entries and sections carrying a comment
+	 */
+	size_t CommentDensity = 10;
+
+	/**
+	 * Number of lookups and sets to measure
+	 */
+	size_t Operations = 1000000;
+
+	/**
+	 * Number of repetitions of load and save, the best run is reported
+	 */
+	size_t Repeat = 3;
+
+	/**
+	 * Number of threads for the parallel load, 0 for the number of hardware threads
+	 */
+	unsigned int Threads = 0;
+
+	/**
+	 * Seed of the generator, same seed gives the same file
+	 */
+	unsigned int Seed = 4711;
+
+	/**
+	 * Generated INI file
+	 */
+	std::string Filename = "yaipbench.ini";
+
+	/**
+	 * Keep generated files after the run
+	 */
+	bool Keep = false;
+};
+
+/**
+ * Clock used for all measurements
+ */
+typedef std::chrono::steady_clock tClock;
+
+// ******************************************************************
+// ******************************************************************
+static double SecondsSince(const tClock::time_point &Start)
+{
+	return std::chrono::duration<double>(tClock::now() - Start).count();
+}
+
+// ******************************************************************
+// ******************************************************************
+static size_t PeakResidentKiB(void)
+{
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS Counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &Counters, sizeof(Counters)))
+	{
+		return static_cast<size_t>(Counters.PeakWorkingSetSize / 1024);
+	}
+	return 0;
+#else
+	struct rusage Usage;
+	if (0 != getrusage(RUSAGE_SELF, &Usage))
+	{
+		return 0;
+	}
+#ifdef __APPLE__
+	// Reported in bytes on macOS, in KiB everywhere else
+	return static_cast<size_t>(Usage.ru_maxrss / 1024);
+#else
+	return static_cast<size_t>(Usage.ru_maxrss);
+#endif
+#endif
+}
+
+// ******************************************************************
+// ******************************************************************
+static std::string SectionName(size_t Index)
+{
+	return "section" + std::to_string(Index);
+}
+
+// ******************************************************************
+// ******************************************************************
+static std::string KeyName(size_t Index)
+{
+	return "key" + std::to_string(Index);
+}
+
+// ******************************************************************
+// ******************************************************************
+static size_t CorpusGenerate(const BenchConfig &Config)
+{
+	static const char Alphabet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_.-";
+
+	std::mt19937 Generator(Config.Seed);
+	std::uniform_int_distribution<size_t> Character(0, sizeof(Alphabet) - 2);
+	std::uniform_int_distribution<size_t> Percent(0, 99);
+
+	std::ofstream IniFile(Config.Filename, std::ios::trunc | std::ios::binary);
+	if (!IniFile.is_open())
+	{
+		return 0;
+	}
+
+	std::string Value(Config.ValueLength, ' ');
+	for (size_t SectionIndex = 0; SectionIndex < Config.Sections; ++SectionIndex)
+	{
+		if (Percent(Generator) < Config.CommentDensity)
+		{
+			IniFile << "; comment line before section " << SectionIndex << "\n";
+		}
+
+		IniFile << "[" << SectionName(SectionIndex) << "]";
+		if (Percent(Generator) < Config.CommentDensity)
+		{
+			IniFile << " ; section comment";
+		}
+		IniFile << "\n";
+
+		for (size_t KeyIndex = 0; KeyIndex < Config.Keys; ++KeyIndex)
+		{
+			for (auto &Loop : Value)
+			{
+				Loop = Alphabet[Character(Generator)];
+			}
+
+			IniFile << KeyName(KeyIndex) << " = " << Value;
+			if (Percent(Generator) < Config.CommentDensity)
+			{
+				IniFile << " ; entry comment";
+			}
+			IniFile << "\n";
+		}
+		IniFile << "\n";
+	}
+
+	return static_cast<size_t>(IniFile.tellp());
+}
+
+// ******************************************************************
+// ******************************************************************
+static void ReportLine(const std::string &Name, double Seconds, double Count, const std::string &Unit)
+{
+	std::printf("%-28s %12.3f ms", Name.c_str(), Seconds * 1000.0);
+	if (0.0 < Count)
+	{
+		std::printf(" %14.0f %s/s", Count / Seconds, Unit.c_str());
+	}
+	std::printf("\n");
+}
+
+// ******************************************************************
+// ******************************************************************
+static double LoadMeasure(const BenchConfig &Config, net::derpaul::yaip::IniLoadMode Mode, unsigned int Threads, bool Cache)
+{
+	double Best = 0.0;
+
+	// Write the binary image first, only loads using a valid image are measured
+	if (Cache)
+	{
+		net::derpaul::yaip::YAIP Parser;
+		Parser.CacheEnable(true);
+		Parser.INIFileLoad(Config.Filename);
+	}
+
+	for (size_t Run = 0; Run < Config.Repeat; ++Run)
+	{
+		net::derpaul::yaip::YAIP Parser;
+		Parser.LoadModeSet(Mode);
+		Parser.ThreadCountSet(Threads);
+		Parser.CacheEnable(Cache);
+
+		tClock::time_point Start = tClock::now();
+		Parser.INIFileLoad(Config.Filename);
+		double Seconds = SecondsSince(Start);
+
+		Best = ((0 == Run) || (Seconds < Best)) ? Seconds : Best;
+	}
+
+	return Best;
+}
+
+// ******************************************************************
+// ******************************************************************
+static void Usage(const char *Program)
+{
+	std::cout << "Usage: " << Program << " [options]" << std::endl
+		<< "  --sections=N     Number of sections (default 1000)" << std::endl
+		<< "  --keys=N         Keys per section (default 20)" << std::endl
+		<< "  --value-length=N Length of each value (default 16)" << std::endl
+		<< "  --comments=N     Percentage of lines with comments (default 10)" << std::endl
+		<< "  --operations=N   Number of lookups/sets to measure (default 1000000)" << std::endl
+		<< "  --repeat=N       Load/save repetitions, best is reported (default 3)" << std::endl
+		<< "  --threads=N      Threads of the parallel load, 0 for all (default 0)" << std::endl
+		<< "  --seed=N         Seed of the generator (default 4711)" << std::endl
+		<< "  --file=NAME      Generated INI file (default yaipbench.ini)" << std::endl
+		<< "  --keep           Keep generated files" << std::endl;
+}
+
+// ******************************************************************
+// ******************************************************************
+static bool ArgumentsParse(int argc, char *argv[], BenchConfig &Config)
+{
+	for (int Index = 1; Index < argc; ++Index)
+	{
+		std::string Argument = argv[Index];
+		std::string::size_type Equal = Argument.find('=');
+		std::string Name = Argument.substr(0, Equal);
+		std::string Value = (std::string::npos == Equal) ? "" : Argument.substr(Equal + 1);
+		size_t Number = static_cast<size_t>(std::strtoull(Value.c_str(), nullptr, 10));
+
+		if ("--sections" == Name) Config.Sections = Number;
+		else if ("--keys" == Name) Config.Keys = Number;
+		else if ("--value-length" == Name) Config.ValueLength = Number;
+		else if ("--comments" == Name) Config.CommentDensity = Number;
+		else if ("--operations" == Name) Config.Operations = Number;
+		else if ("--repeat" == Name) Config.Repeat = (0 == Number) ? 1 : Number;
+		else if ("--threads" == Name) Config.Threads = static_cast<unsigned int>(Number);
+		else if ("--seed" == Name) Config.Seed = static_cast<unsigned int>(Number);
+		else if ("--file" == Name) Config.Filename = Value;
+		else if ("--keep" == Name) Config.Keep = true;
+		else
+		{
+			Usage(argv[0]);
+			return false;
+		}
+	}
+
+	// At least one section and one key, otherwise there is nothing to look up
+	Config.Sections = (0 == Config.Sections) ? 1 : Config.Sections;
+	Config.Keys = (0 == Config.Keys) ? 1 : Config.Keys;
+	Config.ValueLength = (0 == Config.ValueLength) ? 1 : Config.ValueLength;
+
+	return true;
+}
+
+// ******************************************************************
+// ******************************************************************
+int main(int argc, char *argv[])
+{
+	BenchConfig Config;
+	if (!ArgumentsParse(argc, argv, Config))
+	{
+		return 1;
+	}
+
+	tClock::time_point Start = tClock::now();
+	size_t FileSize = CorpusGenerate(Config);
+	double Seconds = SecondsSince(Start);
+	if (0 == FileSize)
+	{
+		std::cerr << "Cannot write " << Config.Filename << std::endl;
+		return 1;
+	}
+
+	double Entries = static_cast<double>(Config.Sections * Config.Keys);
+	std::printf("Corpus: %zu sections x %zu keys, value length %zu, comments %zu%%, %zu bytes\n\n",
+		Config.Sections, Config.Keys, Config.ValueLength, Config.CommentDensity, FileSize);
+	ReportLine("generate", Seconds, 0.0, "");
+
+	// Load and parse, best of all repetitions
+	Seconds = LoadMeasure(Config, net::derpaul::yaip::IniLoadMode::Mapped, 1, false);
+	ReportLine("load (mapped)", Seconds, Entries, "entries");
+	Seconds = LoadMeasure(Config, net::derpaul::yaip::IniLoadMode::Stream, 1, false);
+	ReportLine("load (stream)", Seconds, Entries, "entries");
+	Seconds = LoadMeasure(Config, net::derpaul::yaip::IniLoadMode::Mapped, Config.Threads, false);
+	ReportLine("load (mapped, parallel)", Seconds, Entries, "entries");
+	Seconds = LoadMeasure(Config, net::derpaul::yaip::IniLoadMode::Mapped, 1, true);
+	ReportLine("load (cached)", Seconds, Entries, "entries");
+
+	net::derpaul::yaip::YAIP Parser;
+	Parser.INIFileLoad(Config.Filename);
+
+	// Precompute names, the benchmark should not measure std::to_string
+	std::mt19937 Generator(Config.Seed);
+	std::uniform_int_distribution<size_t> SectionPick(0, Config.Sections - 1);
+	std::uniform_int_distribution<size_t> KeyPick(0, Config.Keys - 1);
+	std::vector<std::string> Sections;
+	std::vector<std::string> Keys;
+	for (size_t Index = 0; Index < Config.Sections; ++Index)
+	{
+		Sections.push_back(SectionName(Index));
+	}
+	for (size_t Index = 0; Index < Config.Keys; ++Index)
+	{
+		Keys.push_back(KeyName(Index));
+	}
+
+	const size_t Probes = 4096;
+	std::vector<std::pair<size_t, size_t>> Pattern;
+	for (size_t Index = 0; Index < Probes; ++Index)
+	{
+		Pattern.push_back(std::make_pair(SectionPick(Generator), KeyPick(Generator)));
+	}
+
+	// Lookups of existing keys
+	size_t Found = 0;
+	Start = tClock::now();
+	for (size_t Index = 0; Index < Config.Operations; ++Index)
+	{
+		const std::pair<size_t, size_t> &Probe = Pattern[Index % Probes];
+		Found += Parser.SectionKeyValueGet(Sections[Probe.first], Keys[Probe.second], std::string()).length();
+	}
+	ReportLine("lookup hit (std::string)", SecondsSince(Start), static_cast<double>(Config.Operations), "ops");
+
+	Start = tClock::now();
+	for (size_t Index = 0; Index < Config.Operations; ++Index)
+	{
+		const std::pair<size_t, size_t> &Probe = Pattern[Index % Probes];
+		Found += Parser.SectionKeyValueView(Sections[Probe.first], Keys[Probe.second], "").length();
+	}
+	ReportLine("lookup hit (view)", SecondsSince(Start), static_cast<double>(Config.Operations), "ops");
+
+	// Lookups of keys which do not exist in existing sections
+	const std::string KeyMissing = "missing";
+	Start = tClock::now();
+	for (size_t Index = 0; Index < Config.Operations; ++Index)
+	{
+		const std::pair<size_t, size_t> &Probe = Pattern[Index % Probes];
+		Found += Parser.SectionKeyValueGet(Sections[Probe.first], KeyMissing, std::string()).length();
+	}
+	ReportLine("lookup miss (std::string)", SecondsSince(Start), static_cast<double>(Config.Operations), "ops");
+
+	// Overwrite existing keys
+	const std::string ValueNew(Config.ValueLength, 'x');
+	Start = tClock::now();
+	for (size_t Index = 0; Index < Config.Operations; ++Index)
+	{
+		const std::pair<size_t, size_t> &Probe = Pattern[Index % Probes];
+		Parser.SectionKeyValueSet(Sections[Probe.first], Keys[Probe.second], ValueNew);
+	}
+	ReportLine("set existing", SecondsSince(Start), static_cast<double>(Config.Operations), "ops");
+
+	// Save, best of all repetitions
+	const std::string FilenameSave = Config.Filename + ".save";
+	double Best = 0.0;
+	for (size_t Run = 0; Run < Config.Repeat; ++Run)
+	{
+		Start = tClock::now();
+		Parser.INIFileSave(FilenameSave);
+		Seconds = SecondsSince(Start);
+		Best = ((0 == Run) || (Seconds < Best)) ? Seconds : Best;
+	}
+	ReportLine("save", Best, Entries, "entries");
+
+	std::printf("\nPeak RSS: %zu KiB\n", PeakResidentKiB());
+
+	if (!Config.Keep)
+	{
+		net::derpaul::yaip::YAIP::INIFileDelete(Config.Filename);
+		net::derpaul::yaip::YAIP::INIFileDelete(net::derpaul::yaip::IniCache::FilenameGet(Config.Filename));
+		net::derpaul::yaip::YAIP::INIFileDelete(FilenameSave);
+	}
+
+	// Keep the optimizer from dropping the lookups
+	volatile size_t Sink = Found;
+	(void)Sink;
+
+	return 0;
+}
@@ -24,8 +24,17 @@
  * \brief	Converter between different datatypes and std::string
  */
 #include "Convert.h"
+
+#ifdef YAIP_CHARCONV
+#include <charconv>
+#include <system_error>
+#ifndef __cpp_lib_to_chars
+#error "YAIP_CHARCONV requires std::to_chars/std::from_chars including floating point support"
+#endif
+#else
 #include <sstream>
 #include <iomanip>
+#endif
 #include <limits>
 
 /**
@@ -43,6 +52,112 @@ namespace net
 		 */
 		namespace yaip
 		{
+#ifdef YAIP_CHARCONV
+			// ******************************************************************
+			// ******************************************************************
+			// Large enough for every integer and for floats in scientific notation
+			static const size_t CharBufferSize = 64;
+
+			// ******************************************************************
+			// ******************************************************************
+			// Skip whitespaces and a plus sign like std::sto* does
+			static const char *NumberStart(const char *Begin, const char *End)
+			{
+				while ((Begin < End) && ((' ' == *Begin) || (('\t' <= *Begin) && ('\r' >= *Begin))))
+				{
+					++Begin;
+				}
+
+				if ((Begin + 1 < End) && ('+' == *Begin) && ('-' != *(Begin + 1)))
+				{
+					++Begin;
+				}
+
+				return Begin;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			// Integers are written in plain decimal notation
+			template <typename T>
+			static bool IntegerToString(T Value, std::string &ValueString)
+			{
+				char Buffer[CharBufferSize];
+				std::to_chars_result Result = std::to_chars(Buffer, Buffer + CharBufferSize, Value);
+				ValueString.assign(Buffer, Result.ptr);
+				return true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			// Signed integers are parsed as long long like std::stoll
+			template <typename T>
+			static bool StringToSigned(const std::string &ValueString, T &Value)
+			{
+				const char *End = ValueString.data() + ValueString.length();
+				long long Parsed = 0;
+				std::from_chars_result Result = std::from_chars(NumberStart(ValueString.data(), End), End, Parsed);
+				if (std::errc() != Result.ec)
+				{
+					return false;
+				}
+
+				Value = static_cast<T>(Parsed);
+				return true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			// Unsigned integers are parsed as unsigned long like std::stoul,
+			// which also accepts a negated value
+			template <typename T>
+			static bool StringToUnsigned(const std::string &ValueString, T &Value)
+			{
+				const char *End = ValueString.data() + ValueString.length();
+				const char *Begin = NumberStart(ValueString.data(), End);
+				bool Negative = (Begin < End) && ('-' == *Begin);
+				unsigned long Parsed = 0;
+				std::from_chars_result Result = std::from_chars(Negative ? Begin + 1 : Begin, End, Parsed);
+				if (std::errc() != Result.ec)
+				{
+					return false;
+				}
+
+				Value = static_cast<T>(Negative ? (0UL - Parsed) : Parsed);
+				return true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			// Floating points are written in scientific notation with all significant digits
+			template <typename T>
+			static bool FloatingToString(T Value, std::string &ValueString)
+			{
+				char Buffer[CharBufferSize];
+				std::to_chars_result Result = std::to_chars(Buffer, Buffer + CharBufferSize, Value, std::chars_format::scientific, std::numeric_limits<T>::max_digits10);
+				ValueString.assign(Buffer, Result.ptr);
+				return true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			// Floating points are parsed in any notation like std::stod
+			template <typename T>
+			static bool StringToFloating(const std::string &ValueString, T &Value)
+			{
+				const char *End = ValueString.data() + ValueString.length();
+				T Parsed = 0;
+				std::from_chars_result Result = std::from_chars(NumberStart(ValueString.data(), End), End, Parsed);
+				if (std::errc() != Result.ec)
+				{
+					return false;
+				}
+
+				Value = Parsed;
+				return true;
+			}
+#endif
+
 			// ******************************************************************
 			// ******************************************************************
 			const std::string Convert::StringTrue = "true";
@@ -50,188 +165,278 @@ namespace net
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const bool &Value, std::string &ValueString)
+			bool Convert::ConvertTo(const bool &Value, std::string &ValueString)
 			{
 				ValueString = Convert::StringFalse;
 				if (Value)
 				{
 					ValueString = Convert::StringTrue;
 				}
+				return true;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const std::string &ValueString, bool &Value)
+			bool Convert::ConvertTo(const std::string &ValueString, bool &Value)
 			{
 				Value = false;
 				if (0 == ValueString.compare(Convert::StringTrue))
 				{
 					Value = true;
 				}
+				return true;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const char &Value, std::string &ValueString)
+			bool Convert::ConvertTo(const char &Value, std::string &ValueString)
 			{
 				ValueString = Value;
+				return true;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const std::string &ValueString, char &Value)
+			bool Convert::ConvertTo(const std::string &ValueString, char &Value)
 			{
+				bool Success = false;
 				if (0 < ValueString.length())
 				{
 					Value = ValueString[0];
+					Success = true;
 				}
+				return Success;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const double &Value, std::string &ValueString)
+			bool Convert::ConvertTo(const double &Value, std::string &ValueString)
 			{
+#ifdef YAIP_CHARCONV
+				return FloatingToString(Value, ValueString);
+#else
 				typedef std::numeric_limits<double> Limits;
 				std::ostringstream StringStream;
 				StringStream << std::setprecision(Limits::max_digits10) << std::scientific << Value;
 				ValueString = StringStream.str();
+				return true;
+#endif
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const std::string &ValueString, double &Value)
+			bool Convert::ConvertTo(const std::string &ValueString, double &Value)
 			{
+#ifdef YAIP_CHARCONV
+				return StringToFloating(ValueString, Value);
+#else
 				Value = std::stod(ValueString);
+				return true;
+#endif
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const float &Value, std::string &ValueString)
+			bool Convert::ConvertTo(const float &Value, std::string &ValueString)
 			{
+#ifdef YAIP_CHARCONV
+				return FloatingToString(Value, ValueString);
+#else
 				typedef std::numeric_limits<float> Limits;
 				std::ostringstream StringStream;
 				StringStream << std::setprecision(Limits::max_digits10) << std::scientific << Value;
 				ValueString = StringStream.str();
+				return true;
+#endif
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const std::string &ValueString, float &Value)
+			bool Convert::ConvertTo(const std::string &ValueString, float &Value)
 			{
+#ifdef YAIP_CHARCONV
+				return StringToFloating(ValueString, Value);
+#else
 				Value = std::stof(ValueString);
+				return true;
+#endif
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const int &Value, std::string &ValueString)
+			bool Convert::ConvertTo(const int &Value, std::string &ValueString)
 			{
+#ifdef YAIP_CHARCONV
+				return IntegerToString(Value, ValueString);
+#else
 				std::ostringstream StringStream;
 				StringStream << std::scientific << Value;
 				ValueString = StringStream.str();
+				return true;
+#endif
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const std::string &ValueString, int &Value)
+			bool Convert::ConvertTo(const std::string &ValueString, int &Value)
 			{
+#ifdef YAIP_CHARCONV
+				return StringToSigned(ValueString, Value);
+#else
 				Value = static_cast<int>(std::stoll(ValueString));
+				return true;
+#endif
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const long &Value, std::string &ValueString)
+			bool Convert::ConvertTo(const long &Value, std::string &ValueString)
 			{
+#ifdef YAIP_CHARCONV
+				return IntegerToString(Value, ValueString);
+#else
 				std::ostringstream StringStream;
 				StringStream << std::scientific << Value;
 				ValueString = StringStream.str();
+				return true;
+#endif
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const std::string &ValueString, long &Value)
+			bool Convert::ConvertTo(const std::string &ValueString, long &Value)
 			{
+#ifdef YAIP_CHARCONV
+				return StringToSigned(ValueString, Value);
+#else
 				Value = static_cast<long>(std::stoll(ValueString));
+				return true;
+#endif
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const short &Value, std::string &ValueString)
+			bool Convert::ConvertTo(const short &Value, std::string &ValueString)
 			{
+#ifdef YAIP_CHARCONV
+				return IntegerToString(Value, ValueString);
+#else
 				std::ostringstream StringStream;
 				StringStream << std::scientific << Value;
 				ValueString = StringStream.str();
+				return true;
+#endif
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const std::string &ValueString, short &Value)
+			bool Convert::ConvertTo(const std::string &ValueString, short &Value)
 			{
+#ifdef YAIP_CHARCONV
+				return StringToSigned(ValueString, Value);
+#else
 				Value = static_cast<short>(std::stoll(ValueString));
+				return true;
+#endif
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const unsigned char &Value, std::string &ValueString)
+			bool Convert::ConvertTo(const unsigned char &Value, std::string &ValueString)
 			{
 				ValueString = Value;
+				return true;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const std::string &ValueString, unsigned char &Value)
+			bool Convert::ConvertTo(const std::string &ValueString, unsigned char &Value)
 			{
+				bool Success = false;
 				if (0 < ValueString.length())
 				{
 					Value = ValueString[0];
+					Success = true;
 				}
+				return Success;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const unsigned int &Value, std::string &ValueString)
+			bool Convert::ConvertTo(const unsigned int &Value, std::string &ValueString)
 			{
+#ifdef YAIP_CHARCONV
+				return IntegerToString(Value, ValueString);
+#else
 				std::ostringstream StringStream;
 				StringStream << std::scientific << Value;
 				ValueString = StringStream.str();
+				return true;
+#endif
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const std::string &ValueString, unsigned int &Value)
+			bool Convert::ConvertTo(const std::string &ValueString, unsigned int &Value)
 			{
+#ifdef YAIP_CHARCONV
+				return StringToUnsigned(ValueString, Value);
+#else
 				Value = static_cast<unsigned int>(std::stoul(ValueString));
+				return true;
+#endif
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const unsigned long &Value, std::string &ValueString)
+			bool Convert::ConvertTo(const unsigned long &Value, std::string &ValueString)
 			{
+#ifdef YAIP_CHARCONV
+				return IntegerToString(Value, ValueString);
+#else
 				std::ostringstream StringStream;
 				StringStream << std::scientific << Value;
 				ValueString = StringStream.str();
+				return true;
+#endif
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const std::string &ValueString, unsigned long &Value)
+			bool Convert::ConvertTo(const std::string &ValueString, unsigned long &Value)
 			{
+#ifdef YAIP_CHARCONV
+				return StringToUnsigned(ValueString, Value);
+#else
 				Value = static_cast<unsigned long>(std::stoul(ValueString));
+				return true;
+#endif
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const unsigned short &Value, std::string &ValueString)
+			bool Convert::ConvertTo(const unsigned short &Value, std::string &ValueString)
 			{
+#ifdef YAIP_CHARCONV
+				return IntegerToString(Value, ValueString);
+#else
 				std::ostringstream StringStream;
 				StringStream << std::scientific << Value;
 				ValueString = StringStream.str();
+				return true;
+#endif
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void Convert::ConvertTo(const std::string &ValueString, unsigned short &Value)
+			bool Convert::ConvertTo(const std::string &ValueString, unsigned short &Value)
 			{
+#ifdef YAIP_CHARCONV
+				return StringToUnsigned(ValueString, Value);
+#else
 				Value = static_cast<unsigned short>(std::stoul(ValueString));
+				return true;
+#endif
 			}
 		}
 	}
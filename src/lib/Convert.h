@@ -44,7 +44,11 @@ namespace net
 		namespace yaip
 		{
 			/**
-			 * Class to convert data from and to std::string
+			 * Class to convert data from and to std::string.
+			 * By default numbers are converted using string streams and std::sto*, which
+			 * throw on invalid input. Built with YAIP_CHARCONV numbers are converted using
+			 * std::to_chars/std::from_chars (C++17) without streams, locale or exceptions,
+			 * invalid input is reported by the return value instead.
 			 * \see http://en.cppreference.com/w/cpp/language/types
 			 * <table>
 			 * <caption id="multi_row">Fundamental types</caption>
@@ -80,155 +84,177 @@ namespace net
 				 * Convert bool to std::string
 				 * \param Value Value to convert from
 				 * \param ValueString Value to convert to
+				 * \return true on success, otherwise false
 				 */
-				static void ConvertTo(const bool &Value, std::string &ValueString);
+				static bool ConvertTo(const bool &Value, std::string &ValueString);
 
 				/**
 				 * Convert std::string to bool
 				 * \param ValueString Value to convert from
 				 * \param Value Value to convert to
+				 * \return true on success, otherwise false and Value is unchanged
 				 */
-				static void ConvertTo(const std::string &ValueString, bool &Value);
+				static bool ConvertTo(const std::string &ValueString, bool &Value);
 
 				/**
 				 * Convert char to std::string
 				 * \param Value Value to convert from
 				 * \param ValueString Value to convert to
+				 * \return true on success, otherwise false
 				 */
-				static void ConvertTo(const char &Value, std::string &ValueString);
+				static bool ConvertTo(const char &Value, std::string &ValueString);
 
 				/**
 				 * Convert std::string to char
 				 * \param ValueString Value to convert from
 				 * \param Value Value to convert to
+				 * \return true on success, otherwise false and Value is unchanged
 				 */
-				static void ConvertTo(const std::string &ValueString, char &Value);
+				static bool ConvertTo(const std::string &ValueString, char &Value);
 
 				/**
 				 * Convert double to std::string
 				 * \param Value Value to convert from
 				 * \param ValueString Value to convert to
+				 * \return true on success, otherwise false
 				 */
-				static void ConvertTo(const double &Value, std::string &ValueString);
+				static bool ConvertTo(const double &Value, std::string &ValueString);
 
 				/**
 				 * Convert std::string to double
 				 * \param ValueString Value to convert from
 				 * \param Value Value to convert to
+				 * \return true on success, otherwise false and Value is unchanged
 				 */
-				static void ConvertTo(const std::string &ValueString, double &Value);
+				static bool ConvertTo(const std::string &ValueString, double &Value);
 
 				/**
 				 * Convert float to std::string
 				 * \param Value Value to convert from
 				 * \param ValueString Value to convert to
+				 * \return true on success, otherwise false
 				 */
-				static void ConvertTo(const float &Value, std::string &ValueString);
+				static bool ConvertTo(const float &Value, std::string &ValueString);
 
 				/**
 				 * Convert std::string to float
 				 * \param ValueString Value to convert from
 				 * \param Value Value to convert to
+				 * \return true on success, otherwise false and Value is unchanged
 				 */
-				static void ConvertTo(const std::string &ValueString, float &Value);
+				static bool ConvertTo(const std::string &ValueString, float &Value);
 
 				/**
 				 * Convert int to std::string
 				 * \param Value Value to convert from
 				 * \param ValueString Value to convert to
+				 * \return true on success, otherwise false
 				 */
-				static void ConvertTo(const int &Value, std::string &ValueString);
+				static bool ConvertTo(const int &Value, std::string &ValueString);
 
 				/**
 				 * Convert std::string to int
 				 * \param ValueString Value to convert from
 				 * \param Value Value to convert to
+				 * \return true on success, otherwise false and Value is unchanged
 				 */
-				static void ConvertTo(const std::string &ValueString, int &Value);
+				static bool ConvertTo(const std::string &ValueString, int &Value);
 
 				/**
 				 * Convert long to std::string
 				 * \param Value Value to convert from
 				 * \param ValueString Value to convert to
+				 * \return true on success, otherwise false
 				 */
-				static void ConvertTo(const long &Value, std::string &ValueString);
+				static bool ConvertTo(const long &Value, std::string &ValueString);
 
 				/**
 				 * Convert std::string to long
 				 * \param ValueString Value to convert from
 				 * \param Value Value to convert to
+				 * \return true on success, otherwise false and Value is unchanged
 				 */
-				static void ConvertTo(const std::string &ValueString, long &Value);
+				static bool ConvertTo(const std::string &ValueString, long &Value);
 
 				/**
 				 * Convert short to std::string
 				 * \param Value Value to convert from
 				 * \param ValueString Value to convert to
+				 * \return true on success, otherwise false
 				 */
-				static void ConvertTo(const short &Value, std::string &ValueString);
+				static bool ConvertTo(const short &Value, std::string &ValueString);
 
 				/**
 				 * Convert std::string to short
 				 * \param ValueString Value to convert from
 				 * \param Value Value to convert to
+				 * \return true on success, otherwise false and Value is unchanged
 				 */
-				static void ConvertTo(const std::string &ValueString, short &Value);
+				static bool ConvertTo(const std::string &ValueString, short &Value);
 
 				/**
 				 * Convert unsigned char to std::string
 				 * \param Value Value to convert from
 				 * \param ValueString Value to convert to
+				 * \return true on success, otherwise false
 				 */
-				static void ConvertTo(const unsigned char &Value, std::string &ValueString);
+				static bool ConvertTo(const unsigned char &Value, std::string &ValueString);
 
 				/**
 				 * Convert std::string to unsigned char
 				 * \param ValueString Value to convert from
 				 * \param Value Value to convert to
+				 * \return true on success, otherwise false and Value is unchanged
 				 */
-				static void ConvertTo(const std::string &ValueString, unsigned char &Value);
+				static bool ConvertTo(const std::string &ValueString, unsigned char &Value);
 
 				/**
 				 * Convert unsigned int to std::string
 				 * \param Value Value to convert from
 				 * \param ValueString Value to convert to
+				 * \return true on success, otherwise false
 				 */
-				static void ConvertTo(const unsigned int &Value, std::string &ValueString);
+				static bool ConvertTo(const unsigned int &Value, std::string &ValueString);
 
 				/**
 				 * Convert std::string to unsigned int
 				 * \param ValueString Value to convert from
 				 * \param Value Value to convert to
+				 * \return true on success, otherwise false and Value is unchanged
 				 */
-				static void ConvertTo(const std::string &ValueString, unsigned int &Value);
+				static bool ConvertTo(const std::string &ValueString, unsigned int &Value);
 
 				/**
 				 * Convert unsigned long to std::string
 				 * \param Value Value to convert from
 				 * \param ValueString Value to convert to
+				 * \return true on success, otherwise false
 				 */
-				static void ConvertTo(const unsigned long &Value, std::string &ValueString);
+				static bool ConvertTo(const unsigned long &Value, std::string &ValueString);
 
 				/**
 				 * Convert std::string to unsigned long
 				 * \param ValueString Value to convert from
 				 * \param Value Value to convert to
+				 * \return true on success, otherwise false and Value is unchanged
 				 */
-				static void ConvertTo(const std::string &ValueString, unsigned long &Value);
+				static bool ConvertTo(const std::string &ValueString, unsigned long &Value);
 
 				/**
 				 * Convert unsigned int to std::string
 				 * \param Value Value to convert from
 				 * \param ValueString Value to convert to
+				 * \return true on success, otherwise false
 				 */
-				static void ConvertTo(const unsigned short &Value, std::string &ValueString);
+				static bool ConvertTo(const unsigned short &Value, std::string &ValueString);
 
 				/**
 				 * Convert std::string to unsigned short
 				 * \param ValueString Value to convert from
 				 * \param Value Value to convert to
+				 * \return true on success, otherwise false and Value is unchanged
 				 */
-				static void ConvertTo(const std::string &ValueString, unsigned short &Value);
+				static bool ConvertTo(const std::string &ValueString, unsigned short &Value);
 			};
 		}
 	}
@@ -27,6 +27,8 @@
 #define _IELEMENTCOMMON_H_
 
 #include <string>
+#include "IniString.h"
+#include "IniWriter.h"
 #include "string_extensions.h"
 
  /**
@@ -66,7 +68,7 @@ namespace net
 				 * Get the INI object comment
 				 * \return Comment of INI object
 				 */
-				virtual std::string ElementCommentGet(void) const = 0;
+				virtual const IniString &ElementCommentGet(void) const = 0;
 
 				/**
 				 * Set the INI object comment
@@ -78,7 +80,7 @@ namespace net
 				 * Get the INI object identifier
 				 * \return Unique identifier of INI object
 				 */
-				virtual std::string ElementIdentifierGet(void) const = 0;
+				virtual const IniString &ElementIdentifierGet(void) const = 0;
 
 				/**
 				 * Set the INI object identifier
@@ -91,6 +93,12 @@ namespace net
 				 * \return String representation of an INI entry
 				 */
 				virtual std::string to_string(void) const = 0;
+
+				/**
+				 * Append the string representation to a writer without intermediate strings
+				 * \param Writer Writer to append to
+				 */
+				virtual void Write(IniWriter &Writer) const = 0;
 			};
 		}
 	}
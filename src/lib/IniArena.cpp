@@ -0,0 +1,120 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniArena.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Bump allocator for sections and entries
+ */
+#include "IniArena.h"
+#include <cstdint>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			const size_t IniArena::DefaultBlockSize = 64 * 1024;
+
+			// ******************************************************************
+			// ******************************************************************
+			IniArena::IniArena(size_t BlockSize)
+				: IniArena(BlockSize, nullptr)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniArena::IniArena(size_t BlockSize, const IniMemoryResourcePtr &Upstream)
+				: m_Blocks()
+				, m_BlockSize(BlockSize)
+				, m_Current(nullptr)
+				, m_Remaining(0)
+				, m_Upstream((nullptr != Upstream) ? Upstream : IniMemoryResource::DefaultGet())
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniArena::~IniArena(void)
+			{
+				for (auto const &Block : m_Blocks)
+				{
+					m_Upstream->Deallocate(Block.first, Block.second, alignof(std::max_align_t));
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void *IniArena::Allocate(size_t Size, size_t Alignment)
+			{
+				size_t Padding = (Alignment - (reinterpret_cast<uintptr_t>(m_Current) & (Alignment - 1))) & (Alignment - 1);
+
+				if ((nullptr == m_Current) || (m_Remaining < Size + Padding))
+				{
+					// Oversized requests get a block of their own, the current block is kept
+					size_t BlockSize = (Size + Alignment > m_BlockSize / 4) ? Size + Alignment : m_BlockSize;
+					char *Block = static_cast<char *>(m_Upstream->Allocate(BlockSize, alignof(std::max_align_t)));
+					m_Blocks.push_back(std::make_pair(Block, BlockSize));
+					Padding = (Alignment - (reinterpret_cast<uintptr_t>(Block) & (Alignment - 1))) & (Alignment - 1);
+
+					if (BlockSize != m_BlockSize)
+					{
+						return Block + Padding;
+					}
+
+					m_Current = Block;
+					m_Remaining = BlockSize;
+				}
+
+				void *Memory = m_Current + Padding;
+				m_Current += Padding + Size;
+				m_Remaining -= Padding + Size;
+
+				return Memory;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniArena::BlockCount(void) const
+			{
+				return m_Blocks.size();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniArena::Deallocate(void *, size_t, size_t)
+			{
+			}
+		}
+	}
+}
@@ -0,0 +1,147 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniArena.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Bump allocator for sections and entries
+ */
+#ifndef _INIARENA_H_
+#define _INIARENA_H_
+
+#include "IniMemoryResource.h"
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			/**
+			 * Bump allocator handing out memory from contiguous blocks. Single
+			 * allocations are never freed, all blocks are released at once when
+			 * the arena is destroyed. The monotonic counterpart of
+			 * std::pmr::monotonic_buffer_resource.
+			 * \attention Not thread safe, use one arena per thread
+			 */
+			class IniArena : public IniMemoryResource
+			{
+			public:
+				/**
+				 * Default size of a block
+				 */
+				static const size_t DefaultBlockSize;
+
+				/**
+				 * Constructor, blocks are taken from the global heap
+				 * \param BlockSize Size of a single block
+				 */
+				explicit IniArena(size_t BlockSize);
+
+				/**
+				 * Constructor
+				 * \param BlockSize Size of a single block
+				 * \param Upstream Resource to take the blocks from, nullptr for the global heap
+				 */
+				IniArena(size_t BlockSize, const IniMemoryResourcePtr &Upstream);
+
+				/**
+				 * Default destructor, releases all blocks
+				 */
+				virtual ~IniArena(void);
+
+				/**
+				 * No copy, the blocks are owned by the instance
+				 */
+				IniArena(const IniArena &) = delete;
+
+				/**
+				 * No copy, the blocks are owned by the instance
+				 */
+				IniArena &operator=(const IniArena &) = delete;
+
+				/**
+				 * Get memory from the current block, start a new block if required
+				 * \param Size Number of bytes
+				 * \param Alignment Required alignment, a power of two
+				 * \return Pointer to memory
+				 */
+				virtual void *Allocate(size_t Size, size_t Alignment) override;
+
+				/**
+				 * Number of blocks currently allocated
+				 * \return Number of blocks
+				 */
+				size_t BlockCount(void) const;
+
+				/**
+				 * Memory is released together with the arena
+				 */
+				virtual void Deallocate(void *, size_t, size_t) override;
+
+			private:
+				/**
+				 * All allocated blocks with their size
+				 */
+				std::vector<std::pair<char *, size_t>> m_Blocks;
+
+				/**
+				 * Size of a regular block
+				 */
+				size_t m_BlockSize;
+
+				/**
+				 * Next free byte of the current block
+				 */
+				char *m_Current;
+
+				/**
+				 * Free bytes left in the current block
+				 */
+				size_t m_Remaining;
+
+				/**
+				 * Resource the blocks are taken from
+				 */
+				IniMemoryResourcePtr m_Upstream;
+			};
+
+			/**
+			 * Convenience typedef for lazy usage of smart_pointers for arenas
+			 */
+			typedef std::shared_ptr<IniArena> IniArenaPtr;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,376 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniCache.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Binary image of parsed sections and entries for fast loading
+ */
+#include "IniCache.h"
+#include "IniFileBuffer.h"
+#include "string_extensions.h"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			const uint32_t IniCache::FormatVersion = 3;
+
+			// ******************************************************************
+			// ******************************************************************
+			// Start of every cache file
+			static const char CacheMagic[8] = { 'Y', 'A', 'I', 'P', 'B', 'I', 'N', '\0' };
+
+			// Written in machine byte order, a different value means a different byte order
+			static const uint32_t CacheByteOrder = 0x01020304;
+
+			// Magic followed by version, byte order, key (3 x 64 bit), checksum of the tables and
+			// the string table, section count, entry count, size of string table and a reserved field
+			static const size_t CacheHeaderSize = sizeof(CacheMagic) + 2 * sizeof(uint32_t) + 4 * sizeof(uint64_t) + 4 * sizeof(uint32_t);
+
+			// Name and comment (offset/length) followed by the entry count
+			static const size_t CacheSectionSize = 5 * sizeof(uint32_t);
+
+			// Key, value and comment (offset/length)
+			static const size_t CacheEntrySize = 6 * sizeof(uint32_t);
+
+			// Largest size of the string table and the counts
+			static const uint64_t CacheLimit = 0xFFFFFFFFULL;
+
+			// ******************************************************************
+			// ******************************************************************
+			// Offset of each string already stored in the string table
+			typedef std::unordered_map<std::string, uint32_t> tCacheStrings;
+
+			// ******************************************************************
+			// ******************************************************************
+			template <typename T> static void CacheWrite(std::string &Buffer, T Value)
+			{
+				Buffer.append(reinterpret_cast<const char *>(&Value), sizeof(Value));
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			static void CacheWrite(std::string &Buffer, std::string &Strings, tCacheStrings &Offsets, const IniString &Value)
+			{
+				// Equal strings, e. g. keys repeated in all sections, are stored once
+				uint32_t Offset = 0;
+				if (!Value.empty())
+				{
+					auto Inserted = Offsets.insert(std::make_pair(Value.str(), static_cast<uint32_t>(Strings.length())));
+					if (Inserted.second)
+					{
+						Strings.append(Value.data(), Value.length());
+					}
+					Offset = Inserted.first->second;
+				}
+
+				CacheWrite(Buffer, Offset);
+				CacheWrite(Buffer, static_cast<uint32_t>(Value.length()));
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			static unsigned long CacheProcessId(void)
+			{
+#ifdef _WIN32
+				return static_cast<unsigned long>(_getpid());
+#else
+				return static_cast<unsigned long>(getpid());
+#endif
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			template <typename T> static T CacheRead(const char *&Data)
+			{
+				T Value;
+				memcpy(&Value, Data, sizeof(Value));
+				Data += sizeof(Value);
+				return Value;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			static bool CacheRead(const char *&Data, const char *Strings, uint32_t StringsSize, tStringView &Text)
+			{
+				uint32_t Offset = CacheRead<uint32_t>(Data);
+				uint32_t Length = CacheRead<uint32_t>(Data);
+				if ((Offset > StringsSize) || (Length > StringsSize - Offset))
+				{
+					return false;
+				}
+
+				Text = tStringView(Strings + Offset, Length);
+				return true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniCache::IniCache(void)
+				: m_File()
+				, m_Key()
+				, m_SectionCount(0)
+				, m_EntryCount(0)
+				, m_StringsSize(0)
+				, m_SectionTable(nullptr)
+				, m_EntryTable(nullptr)
+				, m_Strings(nullptr)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniCache::~IniCache(void)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			std::string IniCache::FilenameGet(const std::string &Filename)
+			{
+				return Filename + ".yaipc";
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const IniCacheKey &IniCache::KeyGet(void) const
+			{
+				return m_Key;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniCache::Load(const IniMemoryResourcePtr &Resource, std::vector<IniSectionPtr> &Sections) const
+			{
+				std::vector<IniSectionPtr> Loaded;
+				Loaded.reserve(m_SectionCount);
+
+				const char *SectionTable = m_SectionTable;
+				const char *Entry = m_EntryTable;
+				uint32_t EntriesLeft = m_EntryCount;
+				IniLine Line;
+				Line.Type = IniLineType::Section;
+				tStringView Name;
+				tStringView Comment;
+				for (uint32_t SectionIndex = 0; SectionIndex < m_SectionCount; ++SectionIndex)
+				{
+					// The entries of all sections follow each other in the entry table
+					if (!CacheRead(SectionTable, m_Strings, m_StringsSize, Name) || !CacheRead(SectionTable, m_Strings, m_StringsSize, Comment))
+					{
+						return false;
+					}
+					uint32_t SectionEntries = CacheRead<uint32_t>(SectionTable);
+					if (SectionEntries > EntriesLeft)
+					{
+						return false;
+					}
+					EntriesLeft -= SectionEntries;
+
+					IniSectionPtr Section = IniCreate<IniSection>(Resource, Resource);
+					Line.Identifier = { Name.data(), Name.length() };
+					Line.Comment = { Comment.data(), Comment.length() };
+					Section->CreateFromLine(Line);
+
+					tStringView Key;
+					tStringView Value;
+					for (uint32_t EntryIndex = 0; EntryIndex < SectionEntries; ++EntryIndex)
+					{
+						if (!CacheRead(Entry, m_Strings, m_StringsSize, Key) || !CacheRead(Entry, m_Strings, m_StringsSize, Value) || !CacheRead(Entry, m_Strings, m_StringsSize, Comment))
+						{
+							return false;
+						}
+
+						Section->EntryAdd(IniCreate<IniEntry>(Resource, Resource, Key, Value, Comment));
+					}
+
+					Loaded.push_back(Section);
+				}
+
+				// Entries not owned by any section
+				if (0 != EntriesLeft)
+				{
+					return false;
+				}
+
+				Sections.swap(Loaded);
+				return true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniCache::Open(const std::string &Filename)
+			{
+				if (!m_File.Open(Filename) || (m_File.Size() < CacheHeaderSize))
+				{
+					return false;
+				}
+
+				const char *Current = m_File.Data();
+				if (0 != memcmp(Current, CacheMagic, sizeof(CacheMagic)))
+				{
+					return false;
+				}
+				Current += sizeof(CacheMagic);
+
+				uint32_t Version = CacheRead<uint32_t>(Current);
+				uint32_t ByteOrder = CacheRead<uint32_t>(Current);
+				if ((FormatVersion != Version) || (CacheByteOrder != ByteOrder))
+				{
+					return false;
+				}
+
+				m_Key.Size = CacheRead<uint64_t>(Current);
+				m_Key.Time = CacheRead<int64_t>(Current);
+				m_Key.Hash = CacheRead<uint64_t>(Current);
+				uint64_t Checksum = CacheRead<uint64_t>(Current);
+				m_SectionCount = CacheRead<uint32_t>(Current);
+				m_EntryCount = CacheRead<uint32_t>(Current);
+				m_StringsSize = CacheRead<uint32_t>(Current);
+				CacheRead<uint32_t>(Current);
+
+				// Damaged cache, the counts cannot overflow in 64 bit
+				uint64_t Expected = CacheHeaderSize + static_cast<uint64_t>(m_SectionCount) * CacheSectionSize + static_cast<uint64_t>(m_EntryCount) * CacheEntrySize + m_StringsSize;
+				if (Expected != m_File.Size())
+				{
+					return false;
+				}
+
+				// A damaged image of the right size must not load wrong values
+				if (Checksum != static_cast<uint64_t>(strhash(Current, m_File.Size() - CacheHeaderSize)))
+				{
+					return false;
+				}
+
+				m_SectionTable = Current;
+				m_EntryTable = m_SectionTable + static_cast<size_t>(m_SectionCount) * CacheSectionSize;
+				m_Strings = m_EntryTable + static_cast<size_t>(m_EntryCount) * CacheEntrySize;
+				return true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniCache::Save(const std::string &Filename, const IniCacheKey &Key, const IniSectionList &Sections)
+			{
+				std::string SectionTable;
+				std::string EntryTable;
+				std::string Strings;
+				tCacheStrings Offsets;
+				uint64_t EntryCount = 0;
+
+				for (auto const &Section : Sections)
+				{
+					CacheWrite(SectionTable, Strings, Offsets, Section->ElementIdentifierGet());
+					CacheWrite(SectionTable, Strings, Offsets, Section->ElementCommentGet());
+
+					uint32_t SectionEntries = 0;
+					for (auto const &Entry : Section->SectionEntriesView())
+					{
+						CacheWrite(EntryTable, Strings, Offsets, Entry->ElementIdentifierGet());
+						CacheWrite(EntryTable, Strings, Offsets, Entry->ElementValueGet());
+						CacheWrite(EntryTable, Strings, Offsets, Entry->ElementCommentGet());
+						++SectionEntries;
+					}
+					CacheWrite(SectionTable, SectionEntries);
+					EntryCount += SectionEntries;
+
+					// Offsets are 32 bit, larger files are parsed on every load
+					if ((Strings.length() > CacheLimit) || (EntryCount > CacheLimit))
+					{
+						return false;
+					}
+				}
+
+				// Tables and string table follow the header, the checksum covers all of them
+				const uint32_t SectionCount = static_cast<uint32_t>(SectionTable.length() / CacheSectionSize);
+				std::string Payload;
+				Payload.reserve(SectionTable.length() + EntryTable.length() + Strings.length());
+				Payload.append(SectionTable).append(EntryTable).append(Strings);
+
+				std::string Header(CacheMagic, sizeof(CacheMagic));
+				CacheWrite(Header, FormatVersion);
+				CacheWrite(Header, CacheByteOrder);
+				CacheWrite(Header, Key.Size);
+				CacheWrite(Header, Key.Time);
+				CacheWrite(Header, Key.Hash);
+				CacheWrite(Header, static_cast<uint64_t>(strhash(Payload.data(), Payload.length())));
+				CacheWrite(Header, SectionCount);
+				CacheWrite(Header, static_cast<uint32_t>(EntryCount));
+				CacheWrite(Header, static_cast<uint32_t>(Strings.length()));
+				CacheWrite(Header, static_cast<uint32_t>(0));
+
+				// Write a temporary file first, readers never see a half written cache.
+				// The name is unique, processes started together must not write the same file.
+				static std::atomic<unsigned int> Sequence(0);
+				const std::string FilenameTemp = Filename + "." + std::to_string(CacheProcessId()) + "." + std::to_string(Sequence++) + ".tmp";
+				std::ofstream CacheFile(FilenameTemp, std::ios::out | std::ios::trunc | std::ios::binary);
+				if (!CacheFile.is_open())
+				{
+					return false;
+				}
+				CacheFile.write(Header.data(), static_cast<std::streamsize>(Header.length()));
+				CacheFile.write(Payload.data(), static_cast<std::streamsize>(Payload.length()));
+				CacheFile.close();
+
+				if (CacheFile.fail())
+				{
+					remove(FilenameTemp.c_str());
+					return false;
+				}
+
+#ifdef _WIN32
+				// rename does not replace an existing file on Windows
+				remove(Filename.c_str());
+#endif
+				if (0 != rename(FilenameTemp.c_str(), Filename.c_str()))
+				{
+					remove(FilenameTemp.c_str());
+					return false;
+				}
+
+				return true;
+			}
+		}
+	}
+}
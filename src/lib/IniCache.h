@@ -0,0 +1,193 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniCache.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Binary image of parsed sections and entries for fast loading
+ */
+#ifndef _INICACHE_H_
+#define _INICACHE_H_
+
+#include "IniFileBuffer.h"
+#include "IniMemoryResource.h"
+#include "IniSection.h"
+#include "IniSectionList.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			/**
+			 * Identifies the content of the INI file a cache belongs to
+			 */
+			struct IniCacheKey
+			{
+				/**
+				 * Size of the INI file
+				 */
+				uint64_t Size;
+
+				/**
+				 * Modification time of the INI file in nanoseconds
+				 */
+				int64_t Time;
+
+				/**
+				 * Hash of the content of the INI file, see strhash
+				 */
+				uint64_t Hash;
+			};
+
+			/**
+			 * Reads and writes a versioned binary image of all sections and entries.
+			 * The image consists of a header with the IniCacheKey of the source, a table
+			 * of sections, a table of entries and a string table the tables point into
+			 * with 32 bit offsets and lengths. Equal strings are stored once. A checksum
+			 * in the header covers the tables and the string table. Loading the image
+			 * needs no scanning, trimming or line splitting at all.
+			 * \attention The image uses the byte order of the machine which wrote it,
+			 * images of another byte order or version are rejected
+			 */
+			class IniCache
+			{
+			public:
+				/**
+				 * Version of the binary format, increased on every change of the layout
+				 */
+				static const uint32_t FormatVersion;
+
+				/**
+				 * Default constructor
+				 */
+				IniCache(void);
+
+				/**
+				 * Default destructor
+				 */
+				virtual ~IniCache(void);
+
+				/**
+				 * No copy, the tables point into the file buffer
+				 */
+				IniCache(const IniCache &) = delete;
+
+				/**
+				 * No copy, the tables point into the file buffer
+				 */
+				IniCache &operator=(const IniCache &) = delete;
+
+				/**
+				 * Determine the name of the cache file of an INI file
+				 * \param Filename Full qualified filename of the INI file
+				 * \return Full qualified filename of the cache file
+				 */
+				static std::string FilenameGet(const std::string &Filename);
+
+				/**
+				 * Get the key of the source the opened cache was saved for
+				 * \return The key
+				 */
+				const IniCacheKey &KeyGet(void) const;
+
+				/**
+				 * Create sections and entries of the opened cache
+				 * \param Resource Resource to allocate from, nullptr for the global heap
+				 * \param Sections Receives the sections in the order they were saved
+				 * \return true on success, false for a damaged cache
+				 */
+				bool Load(const IniMemoryResourcePtr &Resource, std::vector<IniSectionPtr> &Sections) const;
+
+				/**
+				 * Open a cache file and check its header, the key is checked by the caller
+				 * \param Filename Full qualified filename of the cache file
+				 * \return true on success, false for missing, foreign or damaged caches
+				 */
+				bool Open(const std::string &Filename);
+
+				/**
+				 * Save sections and entries to a cache file, the file is replaced atomically
+				 * \param Filename Full qualified filename of the cache file
+				 * \param Key Key of the source the sections are parsed from
+				 * \param Sections Sections to save
+				 * \return true on success, false on errors or content too large for 32 bit offsets
+				 */
+				static bool Save(const std::string &Filename, const IniCacheKey &Key, const IniSectionList &Sections);
+
+			private:
+				/**
+				 * The mapped cache file
+				 */
+				IniFileBuffer m_File;
+
+				/**
+				 * Key of the source
+				 */
+				IniCacheKey m_Key;
+
+				/**
+				 * Number of sections
+				 */
+				uint32_t m_SectionCount;
+
+				/**
+				 * Number of entries of all sections
+				 */
+				uint32_t m_EntryCount;
+
+				/**
+				 * Size of the string table
+				 */
+				uint32_t m_StringsSize;
+
+				/**
+				 * Start of the section table
+				 */
+				const char *m_SectionTable;
+
+				/**
+				 * Start of the entry table
+				 */
+				const char *m_EntryTable;
+
+				/**
+				 * Start of the string table
+				 */
+				const char *m_Strings;
+			};
+		}
+	}
+}
+
+#endif
@@ -25,8 +25,8 @@
  */
 
 #include "IniEntry.h"
+#include "IniStringPool.h"
 #include "string_extensions.h"
-#include <sstream>
 #include <iostream>
 
  /**
@@ -61,16 +61,66 @@ namespace net
 			// ******************************************************************
 			// ******************************************************************
 			IniEntry::IniEntry(void)
-				: m_EntryKey()
-				, m_EntryValue()
-				, m_EntryComment()
+				: IniEntry(nullptr)
 			{
 			}
 
+			// ******************************************************************
+			// ******************************************************************
+			IniEntry::IniEntry(const IniMemoryResourcePtr &Resource)
+				: m_CacheType(nullptr)
+				, m_CacheValue(0)
+				, m_EntryComment(Resource.get())
+				, m_EntryKey(Resource.get())
+				, m_EntryValue(Resource.get())
+				, m_Dirty(true)
+				, m_HandleToken()
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniEntry::IniEntry(const IniMemoryResourcePtr &Resource, tStringView Key, tStringView Value, tStringView Comment)
+				: IniEntry(Resource)
+			{
+				m_EntryKey.assign(Key);
+				m_EntryValue.assign(Value);
+				m_EntryComment.assign(Comment);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniEntry::IniEntry(const IniEntry &Entry)
+				: IElementCommon(Entry)
+				, m_CacheType(Entry.m_CacheType)
+				, m_CacheValue(Entry.m_CacheValue)
+				, m_EntryComment(Entry.m_EntryComment)
+				, m_EntryKey(Entry.m_EntryKey)
+				, m_EntryValue(Entry.m_EntryValue)
+				, m_Dirty(Entry.m_Dirty)
+				, m_HandleToken()
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniEntry &IniEntry::operator=(const IniEntry &Entry)
+			{
+				m_CacheType = Entry.m_CacheType;
+				m_CacheValue = Entry.m_CacheValue;
+				m_EntryComment = Entry.m_EntryComment;
+				m_EntryKey = Entry.m_EntryKey;
+				m_EntryValue = Entry.m_EntryValue;
+				m_Dirty = Entry.m_Dirty;
+				return *this;
+			}
+
 			// ******************************************************************
 			// ******************************************************************
 			IniEntry::~IniEntry(void)
 			{
+				// Handles only see the token, the memory of the entry is released as usual
+				HandlesDetach();
 			}
 
 			// ******************************************************************
@@ -85,6 +135,60 @@ namespace net
 			// ******************************************************************
 			// ******************************************************************
 			bool IniEntry::CreateFromRawData(const std::string &RawData)
+			{
+				IniLine Line;
+
+				if (!IniScanner::ScanEntry(RawData.data(), RawData.length(), Line))
+				{
+					return false;
+				}
+
+				return CreateFromLine(Line);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniEntry::CreateFromLine(const IniLine &Line)
+			{
+				bool Success = false;
+
+				if (IniLineType::Entry == Line.Type)
+				{
+					// Tokens are already trimmed by the scanner
+					m_EntryKey.assign(Line.Identifier.Data, Line.Identifier.Length);
+					m_EntryValue.assign(Line.Value.Data, Line.Value.Length);
+					m_EntryComment.assign(Line.Comment.Data, Line.Comment.Length);
+					m_CacheType = nullptr;
+					m_Dirty = true;
+					Success = true;
+				}
+
+				return Success;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniEntry::CreateFromLine(const IniLine &Line, IniStringPool &Pool)
+			{
+				bool Success = false;
+
+				if (IniLineType::Entry == Line.Type)
+				{
+					// Tokens are already trimmed by the scanner
+					Pool.Intern(tStringView(Line.Identifier.Data, Line.Identifier.Length), m_EntryKey);
+					Pool.Intern(tStringView(Line.Value.Data, Line.Value.Length), m_EntryValue);
+					m_EntryComment.assign(Line.Comment.Data, Line.Comment.Length);
+					m_CacheType = nullptr;
+					m_Dirty = true;
+					Success = true;
+				}
+
+				return Success;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniEntry::CreateFromRawDataRegEx(const std::string &RawData)
 			{
 				bool Success = false;
 				std::smatch RegExpMatch;
@@ -106,7 +210,21 @@ namespace net
 
 			// ******************************************************************
 			// ******************************************************************
-			std::string IniEntry::ElementCommentGet(void) const
+			bool IniEntry::DirtyGet(void) const
+			{
+				return m_Dirty;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniEntry::DirtyClear(void)
+			{
+				m_Dirty = false;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const IniString &IniEntry::ElementCommentGet(void) const
 			{
 				return m_EntryComment;
 			}
@@ -115,12 +233,13 @@ namespace net
 			// ******************************************************************
 			void IniEntry::ElementCommentSet(const std::string &ElementComment)
 			{
-				m_EntryComment = trim(ElementComment);
+				m_EntryComment.assign(trimview(ElementComment));
+				m_Dirty = true;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			std::string IniEntry::ElementIdentifierGet(void) const
+			const IniString &IniEntry::ElementIdentifierGet(void) const
 			{
 				return m_EntryKey;
 			}
@@ -129,12 +248,21 @@ namespace net
 			// ******************************************************************
 			void IniEntry::ElementIdentifierSet(const std::string &ElementIdentifier)
 			{
-				m_EntryKey = trim(ElementIdentifier);
+				m_EntryKey.assign(trimview(ElementIdentifier));
+				m_Dirty = true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniEntry::ElementIdentifierSet(const std::string &ElementIdentifier, IniStringPool &Pool)
+			{
+				Pool.Intern(trimview(ElementIdentifier), m_EntryKey);
+				m_Dirty = true;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			std::string IniEntry::ElementValueGet(void) const
+			const IniString &IniEntry::ElementValueGet(void) const
 			{
 				return m_EntryValue;
 			}
@@ -143,30 +271,67 @@ namespace net
 			// ******************************************************************
 			void IniEntry::ElementValueSet(const std::string &ElementValue)
 			{
-				m_EntryValue = trim(ElementValue);
+				// Assign the trimmed range, an update in place reuses the buffer of the old value
+				m_EntryValue.assign(trimview(ElementValue));
+				m_CacheType = nullptr;
+				m_Dirty = true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const std::shared_ptr<IniEntry *> &IniEntry::HandleTokenGet(void)
+			{
+				if (nullptr == m_HandleToken)
+				{
+					m_HandleToken = std::make_shared<IniEntry *>(this);
+				}
+
+				return m_HandleToken;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniEntry::HandlesDetach(void)
+			{
+				if (nullptr != m_HandleToken)
+				{
+					*m_HandleToken = nullptr;
+					m_HandleToken.reset();
+				}
 			}
 
 			// ******************************************************************
 			// ******************************************************************
 			std::string IniEntry::to_string(void) const
 			{
-				std::ostringstream DataStream;
-				DataStream << m_EntryKey << " = " << m_EntryValue;
+				std::string Result;
+				IniWriter Writer(Result);
+				Write(Writer);
+
+				return Result;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniEntry::Write(IniWriter &Writer) const
+			{
+				Writer.Append(m_EntryKey.data(), m_EntryKey.length());
+				Writer.Append(" = ", 3);
+				Writer.Append(m_EntryValue.data(), m_EntryValue.length());
 
 				if (!m_EntryComment.empty())
 				{
-					DataStream << " ; " << m_EntryComment;
+					Writer.Append(" ; ", 3);
+					Writer.Append(m_EntryComment.data(), m_EntryComment.length());
 				}
-				DataStream << std::endl;
-
-				return DataStream.str();
+				Writer.Append('\n');
 			}
 
 			// ******************************************************************
 			// ******************************************************************
 			bool IniEntryCompare(const IniEntryPtr Left, const IniEntryPtr Right)
 			{
-				return strcmpcaseless(Left->ElementIdentifierGet(), Right->ElementIdentifierGet());
+				return strcmpcaseless(Left->ElementIdentifierGet().view(), Right->ElementIdentifierGet().view());
 			}
 		}
 	}
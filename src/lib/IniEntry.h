@@ -26,11 +26,16 @@
 #ifndef _INIENTRY_H_
 #define _INIENTRY_H_
 
+#include "Convert.h"
 #include "IElementCommon.h"
+#include "IniScanner.h"
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <regex>
 #include <string>
+#include <type_traits>
 
  /**
   * Namespace of YAIP
@@ -47,6 +52,8 @@ namespace net
 		 */
 		namespace yaip
 		{
+			class IniStringPool;
+
 			/**
 			 * Represents an INI entry
 			 */
@@ -58,6 +65,37 @@ namespace net
 				 */
 				IniEntry(void);
 
+				/**
+				 * Constructor
+				 * \param Resource Resource for key, value and comment, nullptr for the global heap
+				 * \attention The resource must outlive the entry, e. g. allocate the entry from it, see IniCreate
+				 */
+				explicit IniEntry(const IniMemoryResourcePtr &Resource);
+
+				/**
+				 * Constructor from already trimmed strings, e. g. of IniCache
+				 * \param Resource Resource for key, value and comment, nullptr for the global heap
+				 * \param Key The key of the INI entry
+				 * \param Value Value of INI object
+				 * \param Comment Comment of INI object
+				 * \attention The resource must outlive the entry, e. g. allocate the entry from it, see IniCreate
+				 */
+				IniEntry(const IniMemoryResourcePtr &Resource, tStringView Key, tStringView Value, tStringView Comment);
+
+				/**
+				 * Copy constructor, the copy owns its strings on the global heap, see IniString,
+				 * and has no key handles
+				 * \param Entry Entry to copy
+				 */
+				IniEntry(const IniEntry &Entry);
+
+				/**
+				 * Assignment, key handles keep referring to this entry
+				 * \param Entry Entry to copy
+				 * \return Reference to this entry
+				 */
+				IniEntry &operator=(const IniEntry &Entry);
+
 				/**
 				 * Default destructor
 				 */
@@ -75,11 +113,45 @@ namespace net
 				 */
 				virtual bool CreateFromRawData(const std::string &RawData) override;
 
+				/**
+				 * Take over key, value and comment of a line scanned by IniScanner
+				 * \param Line Line classified as IniLineType::Entry
+				 * \return true on success, otherwise false
+				 */
+				bool CreateFromLine(const IniLine &Line);
+
+				/**
+				 * Take over key, value and comment of a line scanned by IniScanner, key and value are interned
+				 * \param Line Line classified as IniLineType::Entry
+				 * \param Pool Pool to intern key and value
+				 * \return true on success, otherwise false
+				 * \attention The entry must not outlive the pool, e. g. allocate it from the pool
+				 */
+				bool CreateFromLine(const IniLine &Line, IniStringPool &Pool);
+
+				/**
+				 * Will transform string into internal properties using the regular expression
+				 * \param RawData string from INI file to transform
+				 * \return true on success, otherwise false
+				 */
+				bool CreateFromRawDataRegEx(const std::string &RawData);
+
+				/**
+				 * Check if the entry has been modified since the last DirtyClear
+				 * \return true if modified or new, otherwise false
+				 */
+				bool DirtyGet(void) const;
+
+				/**
+				 * Mark entry as saved
+				 */
+				void DirtyClear(void);
+
 				/**
 				 * Get the INI object comment
 				 * \return Comment of INI object
 				 */
-				virtual std::string ElementCommentGet(void) const override;
+				virtual const IniString &ElementCommentGet(void) const override;
 
 				/**
 				 * Set the INI object comment
@@ -91,7 +163,7 @@ namespace net
 				 * Get the unique element identifier aka the key of an INI entry
 				 * \return The key of the INI entry
 				 */
-				virtual std::string ElementIdentifierGet(void) const override;
+				virtual const IniString &ElementIdentifierGet(void) const override;
 
 				/**
 				 * The unique element identifier is the key of an INI entry
@@ -99,11 +171,19 @@ namespace net
 				 */
 				virtual void ElementIdentifierSet(const std::string &ElementIdentifier) override;
 
+				/**
+				 * Set the key to the interned instance of a string
+				 * \param ElementIdentifier The key of the INI entry
+				 * \param Pool Pool to intern the key
+				 * \attention The entry must not outlive the pool, e. g. allocate it from the pool
+				 */
+				void ElementIdentifierSet(const std::string &ElementIdentifier, IniStringPool &Pool);
+
 				/**
 				 * Get the INI object value
 				 * \return Value of INI object
 				 */
-				virtual std::string ElementValueGet(void) const;
+				virtual const IniString &ElementValueGet(void) const;
 
 				/**
 				 * Set the INI object value
@@ -111,12 +191,57 @@ namespace net
 				 */
 				virtual void ElementValueSet(const std::string &ElementValue);
 
+				/**
+				 * Get the token of key handles referring to this entry. It is created on
+				 * first use from the global heap and set to nullptr by HandlesDetach.
+				 * \return Token of this entry, see IniKeyHandle
+				 */
+				const std::shared_ptr<IniEntry *> &HandleTokenGet(void);
+
+				/**
+				 * Invalidate all key handles of this entry, called when the entry is
+				 * removed from its section as it may still be referenced elsewhere
+				 */
+				void HandlesDetach(void);
+
+				/**
+				 * Convert the INI object value. The last successful conversion to an
+				 * arithmetic type is cached, repeated conversions to the same type only
+				 * copy the cached value until the value is changed.
+				 * \param Value Receives the converted value
+				 * \return true on success, false if the value cannot be converted
+				 * \attention Updates the cache, do not call concurrently for the same entry
+				 */
+				template<typename VariableType>
+				bool ElementValueConvert(VariableType &Value) const
+				{
+					return ElementValueConvert(Value, std::integral_constant<bool, std::is_arithmetic<VariableType>::value && (sizeof(VariableType) <= sizeof(m_CacheValue))>());
+				}
+
+				/**
+				 * Convert the INI object value with or without the cache of ElementValueConvert
+				 * \param Value Receives the converted value
+				 * \param Cache true to use and update the cache, see YAIP::ValueCacheEnable
+				 * \return true on success, false if the value cannot be converted
+				 */
+				template<typename VariableType>
+				bool ElementValueConvert(VariableType &Value, bool Cache) const
+				{
+					return Cache ? ElementValueConvert(Value) : Convert::ConvertTo(m_EntryValue.str(), Value);
+				}
+
 				/**
 				 * String representation of an INI entry
 				 * \return String representation of an INI entry
 				 */
 				std::string to_string(void) const override;
 
+				/**
+				 * Append the string representation to a writer without intermediate strings
+				 * \param Writer Writer to append to
+				 */
+				virtual void Write(IniWriter &Writer) const override;
+
 			private:
 				/**
 				 * Section - Regular expression
@@ -138,20 +263,88 @@ namespace net
 				 */
 				static const int IndexEntryValue;
 
+				/**
+				 * Type of the cached value, nullptr if nothing is cached
+				 */
+				mutable const void *m_CacheType;
+
+				/**
+				 * Value converted last, see ElementValueConvert
+				 */
+				mutable uint64_t m_CacheValue;
+
 				/**
 				 * The comment of the INI entry
 				 */
-				std::string m_EntryComment;
+				IniString m_EntryComment;
+
+				/**
+				 * The key aka unique identifier of the INI entry, owned or interned.
+				 * Copies of the entry own their key.
+				 */
+				IniString m_EntryKey;
+
+				/**
+				 * The value of the INI entry, owned or interned.
+				 * Copies of the entry own their value.
+				 */
+				IniString m_EntryValue;
+
+				/**
+				 * Flag if modified since the last save
+				 */
+				bool m_Dirty;
 
 				/**
-				 * The key aka unique identifier of the INI entry
+				 * Token of key handles, nullptr until the first handle is created
 				 */
-				std::string m_EntryKey;
+				std::shared_ptr<IniEntry *> m_HandleToken;
+
+				/**
+				 * Unique tag of a type, the address of a static per instantiation
+				 * \return Tag of the type
+				 */
+				template<typename VariableType>
+				static const void *CacheTypeGet(void)
+				{
+					static const char Tag = 0;
+					return &Tag;
+				}
+
+				/**
+				 * Convert using the cache for arithmetic types
+				 * \param Value Receives the converted value
+				 * \return true on success, false if the value cannot be converted
+				 */
+				template<typename VariableType>
+				bool ElementValueConvert(VariableType &Value, std::true_type) const
+				{
+					if (CacheTypeGet<VariableType>() == m_CacheType)
+					{
+						memcpy(&Value, &m_CacheValue, sizeof(Value));
+						return true;
+					}
+
+					if (!Convert::ConvertTo(m_EntryValue.str(), Value))
+					{
+						return false;
+					}
+
+					memcpy(&m_CacheValue, &Value, sizeof(Value));
+					m_CacheType = CacheTypeGet<VariableType>();
+					return true;
+				}
 
 				/**
-				 * The value of the INI entry
+				 * Convert without cache for all other types
+				 * \param Value Receives the converted value
+				 * \return true on success, false if the value cannot be converted
 				 */
-				std::string m_EntryValue;
+				template<typename VariableType>
+				bool ElementValueConvert(VariableType &Value, std::false_type) const
+				{
+					return Convert::ConvertTo(m_EntryValue.str(), Value);
+				}
 			};
 
 			/**
@@ -41,6 +41,35 @@ namespace net
 		 */
 		namespace yaip
 		{
+			// ******************************************************************
+			// ******************************************************************
+			IniEntryList::IniEntryList(void)
+				: TIniElementList<IniEntryPtr>()
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniEntryList::IniEntryList(const IniMemoryResourcePtr &Resource)
+				: TIniElementList<IniEntryPtr>(Resource)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const IniEntryList &IniEntryList::EmptyGet(void)
+			{
+				static const IniEntryList Empty;
+				return Empty;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniEntryList::IsSorted(void) const
+			{
+				return std::is_sorted(m_Elements.begin(), m_Elements.end(), net::derpaul::yaip::IniEntryCompare);
+			}
+
 			// ******************************************************************
 			// ******************************************************************
 			void IniEntryList::sort(void)
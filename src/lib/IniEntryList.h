@@ -50,6 +50,29 @@ namespace net
 			class IniEntryList : public TIniElementList<IniEntryPtr>
 			{
 			public:
+				/**
+				 * Default constructor, uses the global heap
+				 */
+				IniEntryList(void);
+
+				/**
+				 * Constructor
+				 * \param Resource Resource for the list, nullptr for the global heap
+				 */
+				explicit IniEntryList(const IniMemoryResourcePtr &Resource);
+
+				/**
+				 * Shared empty list, e. g. for views of sections which do not exist
+				 * \return Empty list
+				 */
+				static const IniEntryList &EmptyGet(void);
+
+				/**
+				 * Check if entries are sorted alphabetically by their key
+				 * \return true if sorted, otherwise false
+				 */
+				bool IsSorted(void) const;
+
 				/**
 				 * We need to sort the own list
 				 */
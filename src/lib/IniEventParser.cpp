@@ -0,0 +1,238 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniEventParser.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Event driven parser for INI files of any size
+ */
+#include "IniEventParser.h"
+#include <cstring>
+#include <fstream>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			const size_t IniEventParser::DefaultChunkSize = 64 * 1024;
+
+			// ******************************************************************
+			// ******************************************************************
+			IniEventParser::IniEventParser(IIniEventHandler &Handler)
+				: IniEventParser(Handler, DefaultChunkSize)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniEventParser::IniEventParser(IIniEventHandler &Handler, size_t ChunkSize)
+				: m_Buffer()
+				, m_ChunkSize((0 == ChunkSize) ? DefaultChunkSize : ChunkSize)
+				, m_Handler(Handler)
+				, m_LineNumber(0)
+				, m_Section()
+				, m_SectionSeen(false)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniEventParser::~IniEventParser(void)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniEventParser::LineNumberGet(void) const
+			{
+				return m_LineNumber;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniEventParser::ParseData(const char *Data, size_t Length)
+			{
+				Reset();
+
+				size_t Consumed = 0;
+				if (!ParseLines(Data, Length, Consumed))
+				{
+					return false;
+				}
+
+				// Last line without line feed
+				if (Consumed < Length)
+				{
+					return ParseLine(Data + Consumed, Length - Consumed);
+				}
+
+				return true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniEventParser::ParseFile(const std::string &Filename)
+			{
+				std::ifstream IniFile(Filename, std::ios::in | std::ios::binary);
+				if (!IniFile.is_open())
+				{
+					return false;
+				}
+
+				return ParseStream(IniFile);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniEventParser::ParseStream(std::istream &Stream)
+			{
+				Reset();
+				m_Buffer.resize(m_ChunkSize);
+
+				// Bytes of an incomplete line kept at the start of the buffer
+				size_t Used = 0;
+
+				for (;;)
+				{
+					// A line longer than the buffer lets the buffer grow
+					if (Used == m_Buffer.size())
+					{
+						m_Buffer.resize(m_Buffer.size() * 2);
+					}
+
+					Stream.read(m_Buffer.data() + Used, static_cast<std::streamsize>(m_Buffer.size() - Used));
+					size_t Count = static_cast<size_t>(Stream.gcount());
+					if (0 == Count)
+					{
+						break;
+					}
+					Used += Count;
+
+					size_t Consumed = 0;
+					if (!ParseLines(m_Buffer.data(), Used, Consumed))
+					{
+						return false;
+					}
+
+					Used -= Consumed;
+					if ((0 < Used) && (0 < Consumed))
+					{
+						memmove(m_Buffer.data(), m_Buffer.data() + Consumed, Used);
+					}
+				}
+
+				if (Stream.bad())
+				{
+					return false;
+				}
+
+				// Last line without line feed
+				if (0 < Used)
+				{
+					return ParseLine(m_Buffer.data(), Used);
+				}
+
+				return true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniEventParser::Reset(void)
+			{
+				m_LineNumber = 0;
+				m_Section.clear();
+				m_SectionSeen = false;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniEventParser::ParseLines(const char *Data, size_t Length, size_t &Consumed)
+			{
+				const char *Current = Data;
+				const char *End = Data + Length;
+
+				Consumed = 0;
+				while (Current < End)
+				{
+					const char *LineEnd = static_cast<const char *>(memchr(Current, '\n', End - Current));
+					if (nullptr == LineEnd)
+					{
+						break;
+					}
+
+					if (!ParseLine(Current, LineEnd - Current))
+					{
+						return false;
+					}
+
+					Current = LineEnd + 1;
+					Consumed = Current - Data;
+				}
+
+				return true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniEventParser::ParseLine(const char *Data, size_t Length)
+			{
+				IniLine Line;
+				bool Continue = true;
+
+				++m_LineNumber;
+				switch (IniScanner::Scan(Data, Length, Line))
+				{
+				case IniLineType::Comment:
+					Continue = m_Handler.OnComment(Line.Comment);
+					break;
+				case IniLineType::Section:
+					m_Section.assign(Line.Identifier.Data, Line.Identifier.Length);
+					m_SectionSeen = true;
+					Continue = m_Handler.OnSection(Line);
+					break;
+				case IniLineType::Entry:
+					if (m_SectionSeen)
+					{
+						Continue = m_Handler.OnEntry(m_Section, Line);
+					}
+					break;
+				default:
+					// Blank lines and invalid lines are skipped
+					break;
+				}
+
+				return Continue;
+			}
+		}
+	}
+}
@@ -0,0 +1,218 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniEventParser.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Event driven parser for INI files of any size
+ */
+#ifndef _INIEVENTPARSER_H_
+#define _INIEVENTPARSER_H_
+
+#include "IniScanner.h"
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <vector>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			/**
+			 * Interface for the callbacks of IniEventParser. All methods do nothing by
+			 * default, override the ones of interest. Returning false stops parsing.
+			 * \attention Tokens are only valid during the call, copy them if required
+			 */
+			class IIniEventHandler
+			{
+			public:
+				/**
+				 * Default destructor
+				 */
+				virtual ~IIniEventHandler(void)
+				{
+				}
+
+				/**
+				 * Called for each comment line
+				 * \param Comment Trimmed comment without the semicolon
+				 * \return true to continue, false to stop parsing
+				 */
+				virtual bool OnComment(const IniToken &Comment)
+				{
+					(void)Comment;
+					return true;
+				}
+
+				/**
+				 * Called for each key/value pair following a section header, like
+				 * YAIP::INIFileLoad entries in front of the first section are skipped
+				 * \param Section Name of the enclosing section
+				 * \param Line Line classified as IniLineType::Entry
+				 * \return true to continue, false to stop parsing
+				 */
+				virtual bool OnEntry(const std::string &Section, const IniLine &Line)
+				{
+					(void)Section;
+					(void)Line;
+					return true;
+				}
+
+				/**
+				 * Called for each section header
+				 * \param Line Line classified as IniLineType::Section
+				 * \return true to continue, false to stop parsing
+				 */
+				virtual bool OnSection(const IniLine &Line)
+				{
+					(void)Line;
+					return true;
+				}
+			};
+
+			/**
+			 * Event driven parser using the same line grammar as YAIP. Nothing is stored,
+			 * each line is scanned and reported to an IIniEventHandler. Files and streams
+			 * are read in chunks, memory is bounded by the chunk size and the longest line.
+			 */
+			class IniEventParser
+			{
+			public:
+				/**
+				 * Default size of a chunk read from a file or stream
+				 */
+				static const size_t DefaultChunkSize;
+
+				/**
+				 * Constructor
+				 * \param Handler Receives the events
+				 */
+				explicit IniEventParser(IIniEventHandler &Handler);
+
+				/**
+				 * Constructor
+				 * \param Handler Receives the events
+				 * \param ChunkSize Number of bytes read at once
+				 */
+				IniEventParser(IIniEventHandler &Handler, size_t ChunkSize);
+
+				/**
+				 * Default destructor
+				 */
+				virtual ~IniEventParser(void);
+
+				/**
+				 * Number of the line reported last, starting with 1
+				 * \return Line number
+				 */
+				size_t LineNumberGet(void) const;
+
+				/**
+				 * Parse data already in memory
+				 * \param Data The INI file content, lines separated by line feeds
+				 * \param Length Length of the content
+				 * \return true if all lines are parsed, false if stopped by the handler
+				 */
+				bool ParseData(const char *Data, size_t Length);
+
+				/**
+				 * Parse a file chunk by chunk
+				 * \param Filename Full qualified filename of the INI file
+				 * \return true if all lines are parsed, false if the file cannot be read or parsing is stopped by the handler
+				 */
+				bool ParseFile(const std::string &Filename);
+
+				/**
+				 * Parse a stream chunk by chunk
+				 * \param Stream Stream to read until its end
+				 * \return true if all lines are parsed, false on a read error or if stopped by the handler
+				 */
+				bool ParseStream(std::istream &Stream);
+
+			private:
+				/**
+				 * Read buffer, grows only for lines longer than a chunk
+				 */
+				std::vector<char> m_Buffer;
+
+				/**
+				 * Number of bytes read at once
+				 */
+				size_t m_ChunkSize;
+
+				/**
+				 * Receives the events
+				 */
+				IIniEventHandler &m_Handler;
+
+				/**
+				 * Number of the line reported last
+				 */
+				size_t m_LineNumber;
+
+				/**
+				 * Name of the current section, empty before the first section
+				 */
+				std::string m_Section;
+
+				/**
+				 * Flag if a section header has been seen
+				 */
+				bool m_SectionSeen;
+
+				/**
+				 * Reset state before parsing a new input
+				 */
+				void Reset(void);
+
+				/**
+				 * Report all complete lines of a range
+				 * \param Data Start of range
+				 * \param Length Length of range
+				 * \param Consumed Receives number of bytes up to and including the last line feed
+				 * \return true to continue, false if stopped by the handler
+				 */
+				bool ParseLines(const char *Data, size_t Length, size_t &Consumed);
+
+				/**
+				 * Scan a single line and report it
+				 * \param Data Start of the line
+				 * \param Length Length of the line without line feed
+				 * \return true to continue, false if stopped by the handler
+				 */
+				bool ParseLine(const char *Data, size_t Length);
+			};
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,193 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniFileBuffer.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Read only view of a whole file, memory mapped where possible
+ */
+#include "IniFileBuffer.h"
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			// Size of a single read for files which cannot be mapped
+			static const size_t ReadChunkSize = 64 * 1024;
+
+			// ******************************************************************
+			// ******************************************************************
+			IniFileBuffer::IniFileBuffer(void)
+				: m_Buffer()
+				, m_Data(nullptr)
+				, m_Mapping(nullptr)
+				, m_Size(0)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniFileBuffer::~IniFileBuffer(void)
+			{
+				Close();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniFileBuffer::Close(void)
+			{
+#ifndef _WIN32
+				if (nullptr != m_Mapping)
+				{
+					munmap(m_Mapping, m_Size);
+				}
+#endif
+				m_Mapping = nullptr;
+				m_Data = nullptr;
+				m_Size = 0;
+				m_Buffer.clear();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const char *IniFileBuffer::Data(void) const
+			{
+				return m_Data;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniFileBuffer::IsMapped(void) const
+			{
+				return nullptr != m_Mapping;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniFileBuffer::Open(const std::string &Filename)
+			{
+				Close();
+
+#ifdef _WIN32
+				std::ifstream File(Filename, std::ios::in | std::ios::binary);
+				if (!File.is_open())
+				{
+					return false;
+				}
+
+				char Chunk[ReadChunkSize];
+				while (File.read(Chunk, sizeof(Chunk)) || (0 < File.gcount()))
+				{
+					m_Buffer.insert(m_Buffer.end(), Chunk, Chunk + File.gcount());
+				}
+#else
+				int FileDescriptor = open(Filename.c_str(), O_RDONLY);
+				if (0 > FileDescriptor)
+				{
+					return false;
+				}
+
+				struct stat FileStat;
+				if (0 != fstat(FileDescriptor, &FileStat))
+				{
+					close(FileDescriptor);
+					return false;
+				}
+
+				// Regular files are mapped, parsing works directly on the pages
+				if (S_ISREG(FileStat.st_mode) && (0 < FileStat.st_size))
+				{
+					size_t MappingSize = static_cast<size_t>(FileStat.st_size);
+					void *Mapping = mmap(nullptr, MappingSize, PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+					if (MAP_FAILED != Mapping)
+					{
+						madvise(Mapping, MappingSize, MADV_SEQUENTIAL);
+						close(FileDescriptor);
+						m_Mapping = Mapping;
+						m_Data = static_cast<const char *>(Mapping);
+						m_Size = MappingSize;
+						return true;
+					}
+				}
+
+				// Pipes, devices or a failed mapping are read in large chunks
+				for (;;)
+				{
+					size_t Used = m_Buffer.size();
+					m_Buffer.resize(Used + ReadChunkSize);
+					ssize_t Count = read(FileDescriptor, m_Buffer.data() + Used, ReadChunkSize);
+					if ((0 > Count) && (EINTR == errno))
+					{
+						Count = 0;
+					}
+					else if (0 >= Count)
+					{
+						m_Buffer.resize(Used);
+						if (0 > Count)
+						{
+							close(FileDescriptor);
+							m_Buffer.clear();
+							return false;
+						}
+						break;
+					}
+					m_Buffer.resize(Used + static_cast<size_t>(Count));
+				}
+				close(FileDescriptor);
+#endif
+
+				m_Data = m_Buffer.data();
+				m_Size = m_Buffer.size();
+				return true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniFileBuffer::Size(void) const
+			{
+				return m_Size;
+			}
+		}
+	}
+}
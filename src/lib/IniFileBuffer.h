@@ -0,0 +1,147 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniFileBuffer.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Read only view of a whole file, memory mapped where possible
+ */
+#ifndef _INIFILEBUFFER_H_
+#define _INIFILEBUFFER_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			/**
+			 * Method used to read an INI file
+			 */
+			enum class IniLoadMode
+			{
+				/**
+				 * Parse directly out of the memory mapped file, see IniFileBuffer
+				 */
+				Mapped,
+
+				/**
+				 * Read line by line using std::ifstream and std::getline
+				 */
+				Stream
+			};
+
+			/**
+			 * Read only view of a whole file. Regular files are memory mapped,
+			 * everything else (pipes, character devices, platforms without mmap)
+			 * is read in large chunks into an internal buffer.
+			 */
+			class IniFileBuffer
+			{
+			public:
+				/**
+				 * Default constructor
+				 */
+				IniFileBuffer(void);
+
+				/**
+				 * Default destructor
+				 */
+				virtual ~IniFileBuffer(void);
+
+				/**
+				 * No copy, the mapping is owned by the instance
+				 */
+				IniFileBuffer(const IniFileBuffer &) = delete;
+
+				/**
+				 * No copy, the mapping is owned by the instance
+				 */
+				IniFileBuffer &operator=(const IniFileBuffer &) = delete;
+
+				/**
+				 * Release mapping or buffer
+				 */
+				void Close(void);
+
+				/**
+				 * Start of the file content
+				 * \return Pointer to the content, not zero terminated
+				 */
+				const char *Data(void) const;
+
+				/**
+				 * Check if content is memory mapped
+				 * \return true if mapped, false if read into buffer
+				 */
+				bool IsMapped(void) const;
+
+				/**
+				 * Map or read the given file
+				 * \param Filename Full qualified filename
+				 * \return true on success otherwise false
+				 */
+				bool Open(const std::string &Filename);
+
+				/**
+				 * Size of the file content
+				 * \return Size in bytes
+				 */
+				size_t Size(void) const;
+
+			private:
+				/**
+				 * Content for files which cannot be mapped
+				 */
+				std::vector<char> m_Buffer;
+
+				/**
+				 * Start of the content, either mapping or buffer
+				 */
+				const char *m_Data;
+
+				/**
+				 * Start of the mapping, nullptr if not mapped
+				 */
+				void *m_Mapping;
+
+				/**
+				 * Size of the content
+				 */
+				size_t m_Size;
+			};
+		}
+	}
+}
+
+#endif
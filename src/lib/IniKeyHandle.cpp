@@ -0,0 +1,108 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniKeyHandle.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Section/key combination resolved once for repeated access
+ */
+#include "IniKeyHandle.h"
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			IniKeyHandle::IniKeyHandle(void)
+				: m_Entry()
+				, m_Cache(false)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniKeyHandle::IniKeyHandle(const IniEntryPtr &Entry, bool Cache)
+				: m_Entry(Entry->HandleTokenGet())
+				, m_Cache(Cache)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniKeyHandle::~IniKeyHandle(void)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniEntry *IniKeyHandle::EntryGet(void) const
+			{
+				return (nullptr != m_Entry) ? *m_Entry : nullptr;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniKeyHandle::Valid(void) const
+			{
+				return nullptr != EntryGet();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			std::string IniKeyHandle::ValueGet(const std::string &Default) const
+			{
+				const IniEntry *Entry = EntryGet();
+				if ((nullptr != Entry) && !Entry->ElementValueGet().empty())
+				{
+					return Entry->ElementValueGet().str();
+				}
+
+				return Default;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniKeyHandle::ValueSet(const std::string &Value)
+			{
+				IniEntry *Entry = EntryGet();
+				if (nullptr == Entry)
+				{
+					return false;
+				}
+
+				// Owned like values of YAIP::SectionKeyValueSet, an interned value is replaced
+				Entry->ElementValueSet(Value);
+				return true;
+			}
+		}
+	}
+}
@@ -0,0 +1,154 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniKeyHandle.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Section/key combination resolved once for repeated access
+ */
+#ifndef _INIKEYHANDLE_H_
+#define _INIKEYHANDLE_H_
+
+#include "Convert.h"
+#include "IniEntry.h"
+#include <memory>
+#include <string>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			/**
+			 * Refers to the entry of a section/key combination resolved by
+			 * YAIP::KeyHandleGet. Reads and writes go straight to the entry without
+			 * looking up any name. The handle stays valid while other keys or sections
+			 * are added or removed and becomes invalid once its key is removed by
+			 * YAIP::SectionKeyKill, YAIP::Clear or YAIP::INIFileLoad. The handle shares
+			 * a small token with the entry instead of the entry itself, so it neither keeps
+			 * the entry nor an arena or string pool alive after the key is removed.
+			 * \attention Like YAIP a handle must not be used concurrently with modifications
+			 */
+			class IniKeyHandle
+			{
+			public:
+				/**
+				 * Default constructor, creates an invalid handle
+				 */
+				IniKeyHandle(void);
+
+				/**
+				 * Constructor
+				 * \param Entry Entry to refer to
+				 * \param Cache true to use the typed value cache of the entry, see YAIP::ValueCacheEnable
+				 */
+				IniKeyHandle(const IniEntryPtr &Entry, bool Cache);
+
+				/**
+				 * Default destructor
+				 */
+				virtual ~IniKeyHandle(void);
+
+				/**
+				 * Check if the key still exists
+				 * \return true if valid, false if never resolved or the key has been removed
+				 */
+				bool Valid(void) const;
+
+				/**
+				 * Get the value of the key
+				 * \param Default Specified default value in case the handle is invalid or the value is empty
+				 * \return Returns either the default value or the value of the key
+				 */
+				std::string ValueGet(const std::string &Default) const;
+
+				/**
+				 * Templated method to get the value of the key
+				 * \param Default Specified default value in case the handle is invalid or the value is empty
+				 * \return Returns either the default value or the value of the key
+				 */
+				template<typename VariableType>
+				VariableType ValueGet(const VariableType &Default) const
+				{
+					VariableType ValueReturn = Default;
+					const IniEntry *Entry = EntryGet();
+					if ((nullptr != Entry) && !Entry->ElementValueGet().empty() && !Entry->ElementValueConvert(ValueReturn, m_Cache))
+					{
+						ValueReturn = Default;
+					}
+					return ValueReturn;
+				}
+
+				/**
+				 * Set the value of the key. Like YAIP::SectionKeyValueSet the value is owned
+				 * by the entry and not interned, the pool never releases a string.
+				 * \param Value Specified value to set
+				 * \return true on success, false if the handle is invalid
+				 */
+				bool ValueSet(const std::string &Value);
+
+				/**
+				 * Templated method to set the value of the key
+				 * \param Value Specified value to set
+				 * \return true on success, false if the handle is invalid or the value cannot be converted
+				 */
+				template<typename VariableType>
+				bool ValueSet(const VariableType &Value)
+				{
+					std::string ValueString;
+					if (!Convert::ConvertTo(Value, ValueString))
+					{
+						return false;
+					}
+					return ValueSet(ValueString);
+				}
+
+			private:
+				/**
+				 * Token of the entry, refers to nullptr once the key is removed
+				 */
+				std::shared_ptr<IniEntry *> m_Entry;
+
+				/**
+				 * Flag to use the typed value cache, taken from YAIP when the handle is resolved
+				 */
+				bool m_Cache;
+
+				/**
+				 * Get the entry
+				 * \return The entry or nullptr if the handle is invalid
+				 */
+				IniEntry *EntryGet(void) const;
+			};
+		}
+	}
+}
+
+#endif
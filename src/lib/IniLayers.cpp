@@ -0,0 +1,308 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniLayers.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Stack of YAIP instances resolved into one configuration
+ */
+#include "IniLayers.h"
+#include <cstring>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			// Compare a stored identifier with a trimmed view
+			static bool IdentifierEqual(const IniString &Identifier, tStringView Name)
+			{
+				return (Identifier.length() == Name.length()) && (0 == memcmp(Identifier.data(), Name.data(), Name.length()));
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniLayers::IniLayers(void)
+				: m_Layers()
+				, m_Table()
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniLayers::~IniLayers(void)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniLayers::LayerAdd(void)
+			{
+				// A new layer is empty, the table stays valid
+				m_Layers.push_back(std::unique_ptr<YAIP>(new YAIP()));
+				return m_Layers.size() - 1;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniLayers::LayerCountGet(void) const
+			{
+				return m_Layers.size();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const YAIP &IniLayers::LayerGet(size_t Layer) const
+			{
+				return *m_Layers.at(Layer);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniLayers::LayerLoad(size_t Layer, const std::string &Filename)
+			{
+				return LayerUpdate(Layer, [&Filename](YAIP &Parser) { return Parser.INIFileLoad(Filename); });
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniLayers::LayerUpdate(size_t Layer, const std::function<bool(YAIP &)> &Update)
+			{
+				if (Layer >= m_Layers.size())
+				{
+					return false;
+				}
+
+				// Keys of the layer before and after the update, all others keep their winner.
+				// Entries of the layer may be released by the update, drop them from the table first.
+				tKeyNames Names;
+				KeyNamesCollect(Layer, Names);
+				for (auto const &Name : Names)
+				{
+					ResolutionErase(Layer, Name.first, Name.second);
+				}
+
+				bool Success = Update(*m_Layers[Layer]);
+				KeyNamesCollect(Layer, Names);
+
+				for (auto const &Name : Names)
+				{
+					Resolve(Name.first, Name.second);
+				}
+
+				return Success;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniLayers::SectionKeyLayerGet(tStringView Section, tStringView Key) const
+			{
+				const Resolution *Winner = ResolutionFind(Section, Key);
+				return (nullptr != Winner) ? Winner->Layer : std::string::npos;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniLayers::SectionKeyKill(size_t Layer, const std::string &Section, const std::string &Key)
+			{
+				if (Layer >= m_Layers.size())
+				{
+					return false;
+				}
+
+				ResolutionErase(Layer, Section, Key);
+				bool Success = m_Layers[Layer]->SectionKeyKill(Section, Key);
+				Resolve(Section, Key);
+				return Success;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			std::string IniLayers::SectionKeyValueGet(tStringView Section, tStringView Key, const std::string &Default) const
+			{
+				const Resolution *Winner = ResolutionFind(Section, Key);
+				return (nullptr != Winner) ? Winner->Entry->ElementValueGet().str() : Default;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			tStringView IniLayers::SectionKeyValueView(tStringView Section, tStringView Key, tStringView Default) const
+			{
+				const Resolution *Winner = ResolutionFind(Section, Key);
+				if (nullptr != Winner)
+				{
+					const IniString &Value = Winner->Entry->ElementValueGet();
+					return tStringView(Value.data(), Value.length());
+				}
+
+				return Default;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniLayers::SectionKeyValueSet(size_t Layer, const std::string &Section, const std::string &Key, const std::string &Value)
+			{
+				if (Layer >= m_Layers.size())
+				{
+					return false;
+				}
+
+				bool Success = m_Layers[Layer]->SectionKeyValueSet(Section, Key, Value);
+				Resolve(Section, Key);
+				return Success;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniLayers::SizeGet(void) const
+			{
+				return m_Table.size();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniLayers::KeyNamesCollect(size_t Layer, tKeyNames &Names) const
+			{
+				for (auto const &Section : m_Layers[Layer]->SectionListView())
+				{
+					for (auto const &Entry : Section->SectionEntriesView())
+					{
+						Names.push_back(std::make_pair(Section->ElementIdentifierGet().str(), Entry->ElementIdentifierGet().str()));
+					}
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniLayers::KeyHash(tStringView Section, tStringView Key)
+			{
+				size_t Hash = strhash(Section.data(), Section.length());
+				return Hash ^ (strhash(Key.data(), Key.length()) + 0x9e3779b9 + (Hash << 6) + (Hash >> 2));
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniLayers::Resolve(tStringView Section, tStringView Key)
+			{
+				tStringView SectionName = trimview(Section);
+				tStringView KeyName = trimview(Key);
+				size_t Hash = KeyHash(SectionName, KeyName);
+
+				auto Current = m_Table.end();
+				auto Range = m_Table.equal_range(Hash);
+				for (auto it = Range.first; it != Range.second; ++it)
+				{
+					if (IdentifierEqual(it->second.Section->ElementIdentifierGet(), SectionName) && IdentifierEqual(it->second.Entry->ElementIdentifierGet(), KeyName))
+					{
+						Current = it;
+						break;
+					}
+				}
+
+				// Highest layer with a value wins, like YAIP empty values count as missing
+				for (size_t Layer = m_Layers.size(); 0 < Layer--;)
+				{
+					const IniSectionPtr *CurrentSection = m_Layers[Layer]->SectionListView().ElementLookup(SectionName);
+					if (nullptr == CurrentSection)
+					{
+						continue;
+					}
+
+					const IniEntryPtr *CurrentEntry = (*CurrentSection)->EntryLookup(KeyName);
+					if ((nullptr == CurrentEntry) || (*CurrentEntry)->ElementValueGet().empty())
+					{
+						continue;
+					}
+
+					Resolution Winner;
+					Winner.Section = CurrentSection->get();
+					Winner.Entry = CurrentEntry->get();
+					Winner.Layer = Layer;
+					if (m_Table.end() != Current)
+					{
+						Current->second = Winner;
+					}
+					else
+					{
+						m_Table.insert(std::make_pair(Hash, Winner));
+					}
+					return;
+				}
+
+				if (m_Table.end() != Current)
+				{
+					m_Table.erase(Current);
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniLayers::ResolutionErase(size_t Layer, tStringView Section, tStringView Key)
+			{
+				const Resolution *Winner = ResolutionFind(Section, Key);
+				if ((nullptr == Winner) || (Layer != Winner->Layer))
+				{
+					return;
+				}
+
+				auto Range = m_Table.equal_range(KeyHash(trimview(Section), trimview(Key)));
+				for (auto it = Range.first; it != Range.second; ++it)
+				{
+					if (&(it->second) == Winner)
+					{
+						m_Table.erase(it);
+						break;
+					}
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const IniLayers::Resolution *IniLayers::ResolutionFind(tStringView Section, tStringView Key) const
+			{
+				tStringView SectionName = trimview(Section);
+				tStringView KeyName = trimview(Key);
+
+				auto Range = m_Table.equal_range(KeyHash(SectionName, KeyName));
+				for (auto it = Range.first; it != Range.second; ++it)
+				{
+					if (IdentifierEqual(it->second.Section->ElementIdentifierGet(), SectionName) && IdentifierEqual(it->second.Entry->ElementIdentifierGet(), KeyName))
+					{
+						return &(it->second);
+					}
+				}
+
+				return nullptr;
+			}
+		}
+	}
+}
@@ -0,0 +1,286 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniLayers.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Stack of YAIP instances resolved into one configuration
+ */
+#ifndef _INILAYERS_H_
+#define _INILAYERS_H_
+
+#include "YAIP.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			/**
+			 * Stack of layers, e. g. defaults.ini, site.ini and host.ini. A layer added
+			 * later takes precedence over the layers added before. Each section/key
+			 * combination is resolved once to the entry of the highest layer with a
+			 * non empty value and kept in a merged table, so a lookup is a single hash
+			 * lookup regardless of the number of layers. Loading or modifying a layer
+			 * only resolves the keys of this layer again.
+			 * \attention Modify layers only through this class, otherwise the table gets stale
+			 * and may refer to released entries
+			 */
+			class IniLayers
+			{
+			public:
+				/**
+				 * Default constructor
+				 */
+				IniLayers(void);
+
+				/**
+				 * Default destructor
+				 */
+				virtual ~IniLayers(void);
+
+				/**
+				 * No copy, the table refers to the entries of the layers
+				 */
+				IniLayers(const IniLayers &) = delete;
+
+				/**
+				 * No copy, the table refers to the entries of the layers
+				 */
+				IniLayers &operator=(const IniLayers &) = delete;
+
+				/**
+				 * Add an empty layer on top of all others
+				 * \return Index of the new layer
+				 */
+				size_t LayerAdd(void);
+
+				/**
+				 * Number of layers
+				 * \return Number of layers
+				 */
+				size_t LayerCountGet(void) const;
+
+				/**
+				 * Read access to a layer
+				 * \param Layer Index of the layer
+				 * \return The layer
+				 */
+				const YAIP &LayerGet(size_t Layer) const;
+
+				/**
+				 * Load a file into a layer, replacing its content
+				 * \param Layer Index of the layer
+				 * \param Filename Full qualified filename of the INI file
+				 * \return true on success otherwise false
+				 */
+				bool LayerLoad(size_t Layer, const std::string &Filename);
+
+				/**
+				 * Modify a layer with any method of YAIP and update the table afterwards
+				 * \param Layer Index of the layer
+				 * \param Update Function modifying the layer, its result is returned
+				 * \return Result of Update, false for an invalid layer
+				 */
+				bool LayerUpdate(size_t Layer, const std::function<bool(YAIP &)> &Update);
+
+				/**
+				 * Get the layer providing the value of a section/key combination
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \return Index of the layer, std::string::npos if no layer has a value
+				 */
+				size_t SectionKeyLayerGet(tStringView Section, tStringView Key) const;
+
+				/**
+				 * Remove key from a layer, lower layers may provide the value afterwards
+				 * \param Layer Index of the layer
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \return true on success otherwise false
+				 */
+				bool SectionKeyKill(size_t Layer, const std::string &Section, const std::string &Key);
+
+				/**
+				 * Method to retrieve the winning value of the specified section/key combination for std::string
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \param Default Specified default value in case no layer has a value
+				 * \return Returns either the default value or the value of the highest layer
+				 */
+				std::string SectionKeyValueGet(tStringView Section, tStringView Key, const std::string &Default) const;
+
+				/**
+				 * Templated method to retrieve the winning value of the specified section/key combination
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \param Default Specified default value in case no layer has a value
+				 * \return Returns either the default value or the value of the highest layer
+				 */
+				template<typename VariableType>
+				VariableType SectionKeyValueGet(tStringView Section, tStringView Key, const VariableType &Default) const
+				{
+					VariableType ValueReturn = Default;
+					const Resolution *Winner = ResolutionFind(Section, Key);
+					if ((nullptr != Winner) && !Winner->Entry->ElementValueConvert(ValueReturn, m_Layers[Winner->Layer]->ValueCacheEnabled()))
+					{
+						ValueReturn = Default;
+					}
+					return ValueReturn;
+				}
+
+				/**
+				 * Method to retrieve a view of the winning value of the specified section/key combination
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \param Default Specified default value in case no layer has a value
+				 * \return Returns either the default value or a view of the stored value
+				 * \attention The view is valid until the layer providing it is modified
+				 */
+				tStringView SectionKeyValueView(tStringView Section, tStringView Key, tStringView Default) const;
+
+				/**
+				 * Set a value in a layer
+				 * \param Layer Index of the layer
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \param Value Specified value to set
+				 * \return true on success otherwise false
+				 */
+				bool SectionKeyValueSet(size_t Layer, const std::string &Section, const std::string &Key, const std::string &Value);
+
+				/**
+				 * Templated method to set a value in a layer
+				 * \param Layer Index of the layer
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \param Value Specified value to set
+				 * \return true on success otherwise false
+				 */
+				template<typename VariableType>
+				bool SectionKeyValueSet(size_t Layer, const std::string &Section, const std::string &Key, const VariableType &Value)
+				{
+					std::string ValueString;
+					Convert::ConvertTo(Value, ValueString);
+					return SectionKeyValueSet(Layer, Section, Key, ValueString);
+				}
+
+				/**
+				 * Number of section/key combinations with a value in any layer
+				 * \return Number of resolved keys
+				 */
+				size_t SizeGet(void) const;
+
+			private:
+				/**
+				 * Winning entry of a section/key combination
+				 */
+				struct Resolution
+				{
+					/**
+					 * Section of the entry in its layer
+					 */
+					const IniSection *Section;
+
+					/**
+					 * The entry providing the value
+					 */
+					const IniEntry *Entry;
+
+					/**
+					 * Index of the layer
+					 */
+					size_t Layer;
+				};
+
+				/**
+				 * Convenience typedef for the names of section/key combinations
+				 */
+				typedef std::vector<std::pair<std::string, std::string>> tKeyNames;
+
+				/**
+				 * The layers, lowest precedence first
+				 */
+				std::vector<std::unique_ptr<YAIP>> m_Layers;
+
+				/**
+				 * Merged table, hash of section and key to the winning entry
+				 */
+				std::unordered_multimap<size_t, Resolution> m_Table;
+
+				/**
+				 * Collect the names of all keys of a layer
+				 * \param Layer Index of the layer
+				 * \param Names Receives the names
+				 */
+				void KeyNamesCollect(size_t Layer, tKeyNames &Names) const;
+
+				/**
+				 * Hash of a section/key combination
+				 * \param Section Trimmed section
+				 * \param Key Trimmed key
+				 * \return Hash
+				 */
+				static size_t KeyHash(tStringView Section, tStringView Key);
+
+				/**
+				 * Determine the winning entry of a section/key combination and update the table
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 */
+				void Resolve(tStringView Section, tStringView Key);
+
+				/**
+				 * Remove a section/key combination from the table if the layer is its winner,
+				 * required before the layer may release the entry
+				 * \param Layer Index of the layer
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 */
+				void ResolutionErase(size_t Layer, tStringView Section, tStringView Key);
+
+				/**
+				 * Find the winning entry in the table
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \return Winner, nullptr if no layer has a value
+				 */
+				const Resolution *ResolutionFind(tStringView Section, tStringView Key) const;
+			};
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,103 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniMemoryResource.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Memory resources and the allocator used by sections, entries and their lists
+ */
+#include "IniMemoryResource.h"
+#include <cstdint>
+#include <new>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			IniMemoryResource::~IniMemoryResource(void)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniMemoryResource::IsEqual(const IniMemoryResource &Other) const
+			{
+				return this == &Other;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const IniMemoryResourcePtr &IniMemoryResource::DefaultGet(void)
+			{
+				static const IniMemoryResourcePtr Default = std::make_shared<IniHeapResource>();
+				return Default;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void *IniHeapResource::Allocate(size_t Size, size_t Alignment)
+			{
+				if (Alignment <= alignof(std::max_align_t))
+				{
+					return ::operator new(Size);
+				}
+
+				// C++11 has no aligned new, keep the original pointer in front of the aligned memory
+				char *Raw = static_cast<char *>(::operator new(Size + Alignment + sizeof(void *)));
+				uintptr_t Aligned = (reinterpret_cast<uintptr_t>(Raw + sizeof(void *)) + Alignment - 1) & ~(static_cast<uintptr_t>(Alignment) - 1);
+				reinterpret_cast<void **>(Aligned)[-1] = Raw;
+				return reinterpret_cast<void *>(Aligned);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniHeapResource::Deallocate(void *Memory, size_t, size_t Alignment)
+			{
+				if (Alignment <= alignof(std::max_align_t))
+				{
+					::operator delete(Memory);
+					return;
+				}
+
+				::operator delete(static_cast<void **>(Memory)[-1]);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniHeapResource::IsEqual(const IniMemoryResource &Other) const
+			{
+				return nullptr != dynamic_cast<const IniHeapResource *>(&Other);
+			}
+		}
+	}
+}
@@ -0,0 +1,246 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniMemoryResource.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Memory resources and the allocator used by sections, entries and their lists
+ */
+#ifndef _INIMEMORYRESOURCE_H_
+#define _INIMEMORYRESOURCE_H_
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			class IniMemoryResource;
+
+			/**
+			 * Convenience typedef for lazy usage of smart_pointers for memory resources
+			 */
+			typedef std::shared_ptr<IniMemoryResource> IniMemoryResourcePtr;
+
+			/**
+			 * Source of memory, the C++11 counterpart of std::pmr::memory_resource.
+			 * Derive from it to place sections, entries and their lists e. g. into
+			 * a fixed buffer or a shared memory segment.
+			 */
+			class IniMemoryResource
+			{
+			public:
+				/**
+				 * Default destructor
+				 */
+				virtual ~IniMemoryResource(void);
+
+				/**
+				 * Get memory
+				 * \param Size Number of bytes
+				 * \param Alignment Required alignment, a power of two
+				 * \return Pointer to memory, never nullptr
+				 */
+				virtual void *Allocate(size_t Size, size_t Alignment) = 0;
+
+				/**
+				 * Return memory
+				 * \param Memory Pointer returned by Allocate
+				 * \param Size Number of bytes passed to Allocate
+				 * \param Alignment Alignment passed to Allocate
+				 */
+				virtual void Deallocate(void *Memory, size_t Size, size_t Alignment) = 0;
+
+				/**
+				 * Check if memory of this resource can be returned to another one
+				 * \param Other Resource to compare with
+				 * \return true if interchangeable, by default only the same instance
+				 */
+				virtual bool IsEqual(const IniMemoryResource &Other) const;
+
+				/**
+				 * Resource using the global heap, used if no resource is given
+				 * \return The shared heap resource
+				 */
+				static const IniMemoryResourcePtr &DefaultGet(void);
+			};
+
+			/**
+			 * Resource using the global operator new and delete
+			 */
+			class IniHeapResource : public IniMemoryResource
+			{
+			public:
+				/**
+				 * Get memory from the global heap
+				 * \param Size Number of bytes
+				 * \param Alignment Required alignment, a power of two
+				 * \return Pointer to memory
+				 */
+				virtual void *Allocate(size_t Size, size_t Alignment) override;
+
+				/**
+				 * Return memory to the global heap
+				 * \param Memory Pointer returned by Allocate
+				 * \param Size Number of bytes passed to Allocate
+				 * \param Alignment Alignment passed to Allocate
+				 */
+				virtual void Deallocate(void *Memory, size_t Size, size_t Alignment) override;
+
+				/**
+				 * All heap resources share the global heap
+				 * \param Other Resource to compare with
+				 * \return true if Other is a heap resource too
+				 */
+				virtual bool IsEqual(const IniMemoryResource &Other) const override;
+			};
+
+			/**
+			 * Standard allocator on top of a memory resource, e. g. for std::allocate_shared
+			 * and the lists of elements. Every copy keeps the resource alive, so elements
+			 * allocated from it stay valid as long as they are referenced.
+			 */
+			template <typename T> class IniAllocator
+			{
+			public:
+				/**
+				 * Type allocated by this allocator
+				 */
+				typedef T value_type;
+
+				/**
+				 * Swapping lists swaps their resources, see TIniElementList::ResourceSet
+				 */
+				typedef std::true_type propagate_on_container_swap;
+
+				/**
+				 * Default constructor, uses the global heap
+				 */
+				IniAllocator(void)
+					: m_Resource(IniMemoryResource::DefaultGet())
+				{
+				}
+
+				/**
+				 * Constructor
+				 * \param Resource Resource to allocate from, nullptr for the global heap
+				 */
+				explicit IniAllocator(const IniMemoryResourcePtr &Resource)
+					: m_Resource((nullptr != Resource) ? Resource : IniMemoryResource::DefaultGet())
+				{
+				}
+
+				/**
+				 * Rebind constructor
+				 * \param Other Allocator of another type
+				 */
+				template <typename U> IniAllocator(const IniAllocator<U> &Other)
+					: m_Resource(Other.ResourceGet())
+				{
+				}
+
+				/**
+				 * Allocate memory for objects
+				 * \param Count Number of objects
+				 * \return Pointer to memory
+				 */
+				T *allocate(size_t Count)
+				{
+					return static_cast<T *>(m_Resource->Allocate(Count * sizeof(T), alignof(T)));
+				}
+
+				/**
+				 * Return memory of objects to the resource
+				 * \param Memory Pointer returned by allocate
+				 * \param Count Number of objects passed to allocate
+				 */
+				void deallocate(T *Memory, size_t Count)
+				{
+					m_Resource->Deallocate(Memory, Count * sizeof(T), alignof(T));
+				}
+
+				/**
+				 * Get resource of the allocator
+				 * \return The resource
+				 */
+				const IniMemoryResourcePtr &ResourceGet(void) const
+				{
+					return m_Resource;
+				}
+
+			private:
+				/**
+				 * Resource to allocate from
+				 */
+				IniMemoryResourcePtr m_Resource;
+			};
+
+			/**
+			 * Allocators are equal if their resources are interchangeable
+			 */
+			template <typename T, typename U>
+			bool operator==(const IniAllocator<T> &Left, const IniAllocator<U> &Right)
+			{
+				return (Left.ResourceGet() == Right.ResourceGet()) || Left.ResourceGet()->IsEqual(*Right.ResourceGet());
+			}
+
+			/**
+			 * Allocators are equal if their resources are interchangeable
+			 */
+			template <typename T, typename U>
+			bool operator!=(const IniAllocator<T> &Left, const IniAllocator<U> &Right)
+			{
+				return !(Left == Right);
+			}
+
+			/**
+			 * Create a new object, allocated from the resource if there is one
+			 * \param Resource Resource to allocate from, nullptr for the global heap
+			 * \param Arguments Arguments of the constructor
+			 * \return The new object
+			 */
+			template <typename T, typename... Args> std::shared_ptr<T> IniCreate(const IniMemoryResourcePtr &Resource, Args&&... Arguments)
+			{
+				if (nullptr != Resource)
+				{
+					return std::allocate_shared<T>(IniAllocator<T>(Resource), std::forward<Args>(Arguments)...);
+				}
+
+				return std::make_shared<T>(std::forward<Args>(Arguments)...);
+			}
+		}
+	}
+}
+
+#endif
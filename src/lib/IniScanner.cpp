@@ -0,0 +1,217 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniScanner.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Single pass scanner to classify lines of an INI file
+ */
+#include "IniScanner.h"
+#include <cstring>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			IniLineType IniScanner::Scan(const char *Data, size_t Length, IniLine &Line)
+			{
+				const char *End = Data + Length;
+				const char *Current = Data;
+
+				Line.Identifier = { Data, 0 };
+				Line.Value = { Data, 0 };
+				Line.Comment = { Data, 0 };
+
+				while ((Current < End) && IsWhitespace(*Current))
+				{
+					++Current;
+				}
+
+				if (Current == End)
+				{
+					Line.Type = IniLineType::Blank;
+				}
+				else if (';' == *Current)
+				{
+					Line.Type = IniLineType::Comment;
+					Line.Comment = CommentCreate(Current + 1, End);
+				}
+				else if (ScanSection(Data, Length, Line))
+				{
+					Line.Type = IniLineType::Section;
+				}
+				else if (ScanEntry(Data, Length, Line))
+				{
+					Line.Type = IniLineType::Entry;
+				}
+				else
+				{
+					Line.Type = IniLineType::Invalid;
+				}
+
+				return Line.Type;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniScanner::ScanEntry(const char *Data, size_t Length, IniLine &Line)
+			{
+				const char *End = Data + Length;
+				const char *KeyBegin = Data;
+
+				// Same rules as the regular expression of IniEntry: the key is
+				// everything up to the first '=', the value is everything up to
+				// the first ';' and must not be empty, the rest is the comment.
+				while (KeyBegin < End)
+				{
+					const char *Equal = static_cast<const char *>(memchr(KeyBegin, '=', End - KeyBegin));
+					if (nullptr == Equal)
+					{
+						break;
+					}
+
+					const char *ValueBegin = Equal + 1;
+					if ((Equal > KeyBegin) && (ValueBegin < End) && (';' != *ValueBegin))
+					{
+						const char *Semicolon = static_cast<const char *>(memchr(ValueBegin, ';', End - ValueBegin));
+						const char *ValueEnd = (nullptr == Semicolon) ? End : Semicolon;
+
+						Line.Type = IniLineType::Entry;
+						Line.Identifier = TokenCreate(KeyBegin, Equal);
+						Line.Value = TokenCreate(ValueBegin, ValueEnd);
+						Line.Comment = (nullptr == Semicolon) ? IniToken{ End, 0 } : CommentCreate(Semicolon + 1, End);
+						return true;
+					}
+
+					KeyBegin = ValueBegin;
+				}
+
+				return false;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniScanner::ScanSection(const char *Data, size_t Length, IniLine &Line)
+			{
+				const char *End = Data + Length;
+				const char *Current = Data;
+
+				while ((Current < End) && IsWhitespace(*Current))
+				{
+					++Current;
+				}
+
+				if ((Current == End) || ('[' != *Current))
+				{
+					return false;
+				}
+
+				const char *NameBegin = Current + 1;
+				const char *NameEnd = static_cast<const char *>(memchr(NameBegin, ']', End - NameBegin));
+				if ((nullptr == NameEnd) || (NameEnd == NameBegin))
+				{
+					return false;
+				}
+
+				Line.Type = IniLineType::Section;
+				Line.Identifier = TokenCreate(NameBegin, NameEnd);
+				Line.Value = { NameEnd, 0 };
+				Line.Comment = { NameEnd, 0 };
+
+				// Only a semicolon directly after the closing bracket starts a comment
+				Current = NameEnd + 1;
+				while ((Current < End) && IsWhitespace(*Current))
+				{
+					++Current;
+				}
+
+				if ((Current < End) && (';' == *Current))
+				{
+					Line.Comment = CommentCreate(Current + 1, End);
+				}
+
+				return true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniToken IniScanner::CommentCreate(const char *Begin, const char *End)
+			{
+				const char *Current = Begin;
+
+				// A comment ends at the end of the line
+				while ((Current < End) && ('\n' != *Current) && ('\r' != *Current))
+				{
+					++Current;
+				}
+
+				return TokenCreate(Begin, Current);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniScanner::IsWhitespace(char Character)
+			{
+				switch (Character)
+				{
+				case ' ':
+				case '\n':
+				case '\r':
+				case '\t':
+				case '\f':
+				case '\v':
+					return true;
+				default:
+					return false;
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniToken IniScanner::TokenCreate(const char *Begin, const char *End)
+			{
+				while ((Begin < End) && IsWhitespace(*Begin))
+				{
+					++Begin;
+				}
+
+				while ((End > Begin) && IsWhitespace(*(End - 1)))
+				{
+					--End;
+				}
+
+				return IniToken{ Begin, static_cast<size_t>(End - Begin) };
+			}
+		}
+	}
+}
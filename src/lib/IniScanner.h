@@ -0,0 +1,208 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniScanner.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Single pass scanner to classify lines of an INI file
+ */
+#ifndef _INISCANNER_H_
+#define _INISCANNER_H_
+
+#include <cstddef>
+#include <string>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			/**
+			 * Method used to detect sections and key/value pairs while parsing
+			 */
+			enum class IniParseMode
+			{
+				/**
+				 * Use the regular expressions of IniSection and IniEntry
+				 */
+				RegEx,
+
+				/**
+				 * Use the hand written single pass IniScanner
+				 */
+				Scanner
+			};
+
+			/**
+			 * Classification of a single line of an INI file
+			 */
+			enum class IniLineType
+			{
+				/**
+				 * Empty line or whitespaces only
+				 */
+				Blank,
+
+				/**
+				 * Line starting with a semicolon
+				 */
+				Comment,
+
+				/**
+				 * Key/value pair with optional comment
+				 */
+				Entry,
+
+				/**
+				 * Neither section nor key/value pair
+				 */
+				Invalid,
+
+				/**
+				 * Section header with optional comment
+				 */
+				Section
+			};
+
+			/**
+			 * Part of a scanned line, already trimmed, pointing into the scanned data
+			 */
+			struct IniToken
+			{
+				/**
+				 * Start of the token, not zero terminated
+				 */
+				const char *Data;
+
+				/**
+				 * Length of the token
+				 */
+				size_t Length;
+
+				/**
+				 * Copy token into a std::string
+				 * \return Token as std::string
+				 */
+				std::string to_string(void) const
+				{
+					return std::string(Data, Length);
+				}
+			};
+
+			/**
+			 * Result of scanning a line
+			 * \attention The tokens are only valid as long as the scanned data is valid
+			 */
+			struct IniLine
+			{
+				/**
+				 * Classification of the line
+				 */
+				IniLineType Type;
+
+				/**
+				 * Section name or key of an entry
+				 */
+				IniToken Identifier;
+
+				/**
+				 * Value of an entry
+				 */
+				IniToken Value;
+
+				/**
+				 * Comment of a section, an entry or a comment line
+				 */
+				IniToken Comment;
+			};
+
+			/**
+			 * Hand written replacement for the regular expressions of IniSection and
+			 * IniEntry. Each line is classified in one forward pass without any allocation.
+			 */
+			class IniScanner
+			{
+			public:
+				/**
+				 * Classify a line as blank, comment, section, entry or invalid
+				 * \param Data Start of the line
+				 * \param Length Length of the line
+				 * \param Line Receives the classification and the tokens
+				 * \return Classification of the line
+				 */
+				static IniLineType Scan(const char *Data, size_t Length, IniLine &Line);
+
+				/**
+				 * Try to scan a key/value pair like "key = value ; comment"
+				 * \param Data Start of the line
+				 * \param Length Length of the line
+				 * \param Line Receives the tokens on success
+				 * \return true on success, otherwise false
+				 */
+				static bool ScanEntry(const char *Data, size_t Length, IniLine &Line);
+
+				/**
+				 * Try to scan a section header like "[section] ; comment"
+				 * \param Data Start of the line
+				 * \param Length Length of the line
+				 * \param Line Receives the tokens on success
+				 * \return true on success, otherwise false
+				 */
+				static bool ScanSection(const char *Data, size_t Length, IniLine &Line);
+
+			private:
+				/**
+				 * Determine the comment following a semicolon up to the end of the line
+				 * \param Begin First character after the semicolon
+				 * \param End End of data
+				 * \return Trimmed comment
+				 */
+				static IniToken CommentCreate(const char *Begin, const char *End);
+
+				/**
+				 * Check for one of the defined whitespaces
+				 * \param Character Character to check
+				 * \return true for a whitespace, otherwise false
+				 */
+				static bool IsWhitespace(char Character);
+
+				/**
+				 * Create a trimmed token from a range
+				 * \param Begin Start of range
+				 * \param End End of range
+				 * \return Trimmed token
+				 */
+				static IniToken TokenCreate(const char *Begin, const char *End);
+			};
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,211 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniSchema.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Typed description of section/key combinations bound to a struct
+ */
+#ifndef _INISCHEMA_H_
+#define _INISCHEMA_H_
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			/**
+			 * Helper to exclude a parameter from template argument deduction
+			 */
+			template<typename VariableType>
+			struct IniSchemaType
+			{
+				/**
+				 * The type itself
+				 */
+				typedef VariableType type;
+			};
+
+			/**
+			 * Describes one section/key combination, its type, its default and the
+			 * member of the struct receiving the value
+			 */
+			template<typename StructType, typename VariableType>
+			struct IniSchemaField
+			{
+				/**
+				 * Type of the bound struct
+				 */
+				typedef StructType struct_type;
+
+				/**
+				 * Type of the value
+				 */
+				typedef VariableType value_type;
+
+				/**
+				 * Constructor
+				 * \param SectionName Name of the section
+				 * \param KeyName Name of the key
+				 * \param MemberPtr Member of the struct receiving the value
+				 * \param DefaultValue Value used if the key does not exist
+				 */
+				constexpr IniSchemaField(const char *SectionName, const char *KeyName, VariableType StructType::*MemberPtr, const VariableType &DefaultValue)
+					: Section(SectionName)
+					, Key(KeyName)
+					, Member(MemberPtr)
+					, Default(DefaultValue)
+				{
+				}
+
+				/**
+				 * Name of the section
+				 */
+				const char *Section;
+
+				/**
+				 * Name of the key
+				 */
+				const char *Key;
+
+				/**
+				 * Member of the struct receiving the value
+				 */
+				VariableType StructType::*Member;
+
+				/**
+				 * Value used if the key does not exist or cannot be converted
+				 */
+				VariableType Default;
+			};
+
+			/**
+			 * Create a field description, the type is taken from the member
+			 * \param Section Name of the section
+			 * \param Key Name of the key
+			 * \param Member Member of the struct receiving the value
+			 * \param Default Value used if the key does not exist
+			 * \return The field description
+			 */
+			template<typename StructType, typename VariableType>
+			constexpr IniSchemaField<StructType, VariableType> IniSchemaFieldMake(const char *Section, const char *Key, VariableType StructType::*Member, const typename IniSchemaType<VariableType>::type &Default)
+			{
+				return IniSchemaField<StructType, VariableType>(Section, Key, Member, Default);
+			}
+
+			/**
+			 * List of field descriptions of one struct. The list is fixed at compile
+			 * time, YAIP walks it without any lookup of the fields themselves.
+			 * \see YAIP::SchemaBind
+			 */
+			template<typename StructType, typename... FieldTypes>
+			class IniSchema
+			{
+			public:
+				/**
+				 * Type of the bound struct
+				 */
+				typedef StructType struct_type;
+
+				/**
+				 * Number of fields
+				 * \return Number of fields
+				 */
+				static constexpr size_t FieldCountGet(void)
+				{
+					return sizeof...(FieldTypes);
+				}
+
+				/**
+				 * Constructor
+				 * \param Fields Field descriptions
+				 */
+				explicit IniSchema(const FieldTypes &... Fields)
+					: m_Fields(Fields...)
+				{
+				}
+
+				/**
+				 * Call a function object for each field in order of declaration
+				 * \param Function Function object with a call operator for each field type
+				 */
+				template<typename FunctionType>
+				void ForEach(FunctionType &Function) const
+				{
+					ForEachField<0>(Function);
+				}
+
+			private:
+				/**
+				 * Field descriptions
+				 */
+				std::tuple<FieldTypes...> m_Fields;
+
+				/**
+				 * Call the function object for field Index and all following fields
+				 * \param Function Function object
+				 */
+				template<size_t Index, typename FunctionType>
+				typename std::enable_if<(Index < sizeof...(FieldTypes))>::type ForEachField(FunctionType &Function) const
+				{
+					Function(std::get<Index>(m_Fields));
+					ForEachField<Index + 1>(Function);
+				}
+
+				/**
+				 * End of recursion
+				 * \param Function Function object
+				 */
+				template<size_t Index, typename FunctionType>
+				typename std::enable_if<(Index == sizeof...(FieldTypes))>::type ForEachField(FunctionType &Function) const
+				{
+					(void)Function;
+				}
+			};
+
+			/**
+			 * Create a schema, the struct type is taken from the fields
+			 * \param Fields Field descriptions created by IniSchemaFieldMake
+			 * \return The schema
+			 */
+			template<typename StructType, typename... VariableTypes>
+			IniSchema<StructType, IniSchemaField<StructType, VariableTypes>...> IniSchemaMake(const IniSchemaField<StructType, VariableTypes> &... Fields)
+			{
+				return IniSchema<StructType, IniSchemaField<StructType, VariableTypes>...>(Fields...);
+			}
+		}
+	}
+}
+
+#endif
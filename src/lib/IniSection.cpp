@@ -26,7 +26,6 @@
 
 #include "IniSection.h"
 #include "string_extensions.h"
-#include <sstream>
 #include <iostream>
 
  /**
@@ -58,9 +57,19 @@ namespace net
 			// ******************************************************************
 			// ******************************************************************
 			IniSection::IniSection(void)
-				: m_SectionName()
-				, m_SectionComment()
-				, m_Entries()
+				: IniSection(nullptr)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniSection::IniSection(const IniMemoryResourcePtr &Resource)
+				: m_SectionName(Resource.get())
+				, m_SectionComment(Resource.get())
+				, m_Entries(Resource)
+				, m_Dirty(true)
+				, m_SavedLength(0)
+				, m_SavedOffset(std::string::npos)
 			{
 			}
 
@@ -75,7 +84,8 @@ namespace net
 			bool IniSection::AddRawEntry(const std::string &RawEntryData)
 			{
 				bool Success = false;
-				IniEntryPtr EntryPtr(new IniEntry);
+				IniMemoryResourcePtr Resource = m_Entries.ResourceGet();
+				IniEntryPtr EntryPtr = IniCreate<IniEntry>(Resource, Resource);
 
 				if (EntryPtr->CreateFromRawData(RawEntryData))
 				{
@@ -86,18 +96,67 @@ namespace net
 				return Success;
 			}
 
+			// ******************************************************************
+			// ******************************************************************
+			IniSectionPtr IniSection::Clone(void) const
+			{
+				IniSectionPtr Section = std::make_shared<IniSection>();
+				Section->m_SectionName = m_SectionName;
+				Section->m_SectionComment = m_SectionComment;
+
+				for (auto const &Entry : m_Entries)
+				{
+					Section->m_Entries.ElementAdd(std::make_shared<IniEntry>(*Entry));
+				}
+
+				return Section;
+			}
+
 			// ******************************************************************
 			// ******************************************************************
 			void IniSection::clear(void)
 			{
 				ElementIdentifierSet("");
 				ElementCommentSet("");
+				HandlesDetach();
 				m_Entries.clear();
 			}
 
 			// ******************************************************************
 			// ******************************************************************
 			bool IniSection::CreateFromRawData(const std::string &RawData)
+			{
+				IniLine Line;
+
+				if (!IniScanner::ScanSection(RawData.data(), RawData.length(), Line))
+				{
+					return false;
+				}
+
+				return CreateFromLine(Line);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniSection::CreateFromLine(const IniLine &Line)
+			{
+				bool Success = false;
+
+				if (IniLineType::Section == Line.Type)
+				{
+					// Tokens are already trimmed by the scanner
+					m_SectionName.assign(Line.Identifier.Data, Line.Identifier.Length);
+					m_SectionComment.assign(Line.Comment.Data, Line.Comment.Length);
+					m_Dirty = true;
+					Success = true;
+				}
+
+				return Success;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniSection::CreateFromRawDataRegEx(const std::string &RawData)
 			{
 				bool Success = false;
 				std::smatch RegExpMatch;
@@ -118,7 +177,39 @@ namespace net
 
 			// ******************************************************************
 			// ******************************************************************
-			std::string IniSection::ElementCommentGet(void) const
+			bool IniSection::DirtyGet(void) const
+			{
+				if (m_Dirty)
+				{
+					return true;
+				}
+
+				// Entries can also be modified directly, e. g. after EntryFind
+				for (auto const &Entry : m_Entries)
+				{
+					if (Entry->DirtyGet())
+					{
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniSection::DirtyClear(void)
+			{
+				m_Dirty = false;
+				for (auto const &Entry : m_Entries)
+				{
+					Entry->DirtyClear();
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const IniString &IniSection::ElementCommentGet(void) const
 			{
 				return m_SectionComment;
 			}
@@ -127,12 +218,13 @@ namespace net
 			// ******************************************************************
 			void IniSection::ElementCommentSet(const std::string &ElementComment)
 			{
-				m_SectionComment = trim(ElementComment);
+				m_SectionComment.assign(trimview(ElementComment));
+				m_Dirty = true;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			std::string IniSection::ElementIdentifierGet(void) const
+			const IniString &IniSection::ElementIdentifierGet(void) const
 			{
 				return m_SectionName;
 			}
@@ -141,7 +233,8 @@ namespace net
 			// ******************************************************************
 			void IniSection::ElementIdentifierSet(const std::string &ElementIdentifier)
 			{
-				m_SectionName = trim(ElementIdentifier);
+				m_SectionName.assign(trimview(ElementIdentifier));
+				m_Dirty = true;
 			}
 
 			// ******************************************************************
@@ -149,22 +242,50 @@ namespace net
 			void IniSection::EntryAdd(const IniEntryPtr &Entry)
 			{
 				m_Entries.ElementAdd(Entry);
+				m_Dirty = true;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
 			void IniSection::EntryDelete(const IniEntryPtr &Entry)
 			{
-				m_Entries.ElementDelete(Entry);
+				m_Entries.ElementDelete(Entry, [](const IniEntryPtr &Removed) { Removed->HandlesDetach(); });
+				m_Dirty = true;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			IniEntryPtr IniSection::EntryFind(const std::string &EntryName)
+			size_t IniSection::EntriesDelete(const std::set<std::string> &Keys)
+			{
+				size_t Count = m_Entries.ElementsDelete(Keys, [](const IniEntryPtr &Removed) { Removed->HandlesDetach(); });
+				if (0 < Count)
+				{
+					m_Dirty = true;
+				}
+				return Count;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniEntryPtr IniSection::EntryFind(tStringView EntryName) const
 			{
 				return m_Entries.ElementFind(EntryName);
 			}
 
+			// ******************************************************************
+			// ******************************************************************
+			const IniEntryPtr *IniSection::EntryLookup(tStringView EntryName) const
+			{
+				return m_Entries.ElementLookup(EntryName);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const IniEntryPtr *IniSection::EntryLookup(tStringView EntryName, const IniStringPool *Pool) const
+			{
+				return m_Entries.ElementLookup(EntryName, Pool);
+			}
+
 			// ******************************************************************
 			// ******************************************************************
 			tListString IniSection::EntryKeyList(void) const
@@ -172,6 +293,16 @@ namespace net
 				return m_Entries.ElementIdentifierList();
 			}
 
+			// ******************************************************************
+			// ******************************************************************
+			void IniSection::HandlesDetach(void)
+			{
+				for (auto const &Entry : m_Entries)
+				{
+					Entry->HandlesDetach();
+				}
+			}
+
 			// ******************************************************************
 			// ******************************************************************
 			bool IniSection::IsEmpty(void) const
@@ -179,6 +310,28 @@ namespace net
 				return (0 == m_Entries.size());
 			}
 
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniSection::SavedLengthGet(void) const
+			{
+				return m_SavedLength;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniSection::SavedOffsetGet(void) const
+			{
+				return m_SavedOffset;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniSection::SavedRangeSet(size_t Offset, size_t Length)
+			{
+				m_SavedOffset = Offset;
+				m_SavedLength = Length;
+			}
+
 			// ******************************************************************
 			// ******************************************************************
 			IniEntryList IniSection::SectionEntriesGet(void) const
@@ -186,43 +339,66 @@ namespace net
 				return m_Entries;
 			}
 
+			// ******************************************************************
+			// ******************************************************************
+			const IniEntryList &IniSection::SectionEntriesView(void) const
+			{
+				return m_Entries;
+			}
+
 			// ******************************************************************
 			// ******************************************************************
 			void IniSection::SectionEntriesSet(const IniEntryList &SectionEntries)
 			{
 				m_Entries = SectionEntries;
+				m_Dirty = true;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
 			std::string IniSection::to_string(void) const
 			{
-				std::ostringstream DataStream;
+				std::string Result;
+				IniWriter Writer(Result);
+				Write(Writer);
+
+				return Result;
+			}
 
-				DataStream << "[" << m_SectionName << "]";
+			// ******************************************************************
+			// ******************************************************************
+			void IniSection::Write(IniWriter &Writer) const
+			{
+				Writer.Append('[');
+				Writer.Append(m_SectionName.data(), m_SectionName.length());
+				Writer.Append(']');
 				if (!m_SectionComment.empty())
 				{
-					DataStream << " ; " << m_SectionComment;
+					Writer.Append(" ; ", 3);
+					Writer.Append(m_SectionComment.data(), m_SectionComment.length());
 				}
-				DataStream << std::endl;
-				DataStream << m_Entries.to_string();
-				DataStream << std::endl;
-
-				return DataStream.str();
+				Writer.Append('\n');
+				m_Entries.Write(Writer);
+				Writer.Append('\n');
 			}
 
 			// ******************************************************************
 			// ******************************************************************
 			void IniSection::sort(void)
 			{
-				m_Entries.sort();
+				// Only a changed order changes the saved file
+				if (!m_Entries.IsSorted())
+				{
+					m_Entries.sort();
+					m_Dirty = true;
+				}
 			}
 
 			// ******************************************************************
 			// ******************************************************************
 			bool IniSectionCompare(const IniSectionPtr Left, const IniSectionPtr Right)
 			{
-				return strcmpcaseless(Left->ElementIdentifierGet(), Right->ElementIdentifierGet());
+				return strcmpcaseless(Left->ElementIdentifierGet().view(), Right->ElementIdentifierGet().view());
 			}
 		}
 	}
@@ -29,9 +29,11 @@
 #include "IElementCommon.h"
 #include "IniEntry.h"
 #include "IniEntryList.h"
+#include "IniScanner.h"
 #include <iostream>
 #include <memory>
 #include <regex>
+#include <set>
 #include <string>
 
  /**
@@ -60,6 +62,13 @@ namespace net
 				 */
 				IniSection(void);
 
+				/**
+				 * Constructor
+				 * \param Resource Resource for name, comment and the list of entries, nullptr for the global heap
+				 * \attention The resource must outlive the section, e. g. allocate the section from it, see IniCreate
+				 */
+				explicit IniSection(const IniMemoryResourcePtr &Resource);
+
 				/**
 				 * Default destructor
 				 */
@@ -72,6 +81,14 @@ namespace net
 				 */
 				bool AddRawEntry(const std::string &RawEntryData);
 
+				/**
+				 * Create a deep copy of the section, the entries are copied as well. Names,
+				 * values and comments are copied to the global heap, the copy does not depend
+				 * on the resource of this section.
+				 * \return The new section allocated from the global heap
+				 */
+				std::shared_ptr<IniSection> Clone(void) const;
+
 				/**
 				 * To clear object and reset to empty fields
 				 */
@@ -84,11 +101,36 @@ namespace net
 				 */
 				virtual bool CreateFromRawData(const std::string &RawData) override;
 
+				/**
+				 * Take over name and comment of a line scanned by IniScanner
+				 * \param Line Line classified as IniLineType::Section
+				 * \return true on success, otherwise false
+				 */
+				bool CreateFromLine(const IniLine &Line);
+
+				/**
+				 * Will transform string into internal properties using the regular expression
+				 * \param RawData string from INI file to transform
+				 * \return true on success, otherwise false
+				 */
+				bool CreateFromRawDataRegEx(const std::string &RawData);
+
+				/**
+				 * Check if the section or one of its entries has been modified since the last DirtyClear
+				 * \return true if modified or new, otherwise false
+				 */
+				bool DirtyGet(void) const;
+
+				/**
+				 * Mark section and all entries as saved
+				 */
+				void DirtyClear(void);
+
 				/**
 				 * Get the INI object comment
 				 * \return Comment of INI object
 				 */
-				virtual std::string ElementCommentGet(void) const override;
+				virtual const IniString &ElementCommentGet(void) const override;
 
 				/**
 				 * Set the INI object comment
@@ -100,7 +142,7 @@ namespace net
 				 * Get the unique element identifier aka the key of an INI entry
 				 * \return The key of the INI entry
 				 */
-				virtual std::string ElementIdentifierGet(void) const override;
+				virtual const IniString &ElementIdentifierGet(void) const override;
 
 				/**
 				 * The unique element identifier is the key of an INI entry
@@ -120,12 +162,34 @@ namespace net
 				 */
 				void EntryDelete(const IniEntryPtr &Entry);
 
+				/**
+				 * Remove all entries of the given keys in a single pass
+				 * \param Keys Trimmed keys of the entries to delete
+				 * \return Number of deleted entries
+				 */
+				size_t EntriesDelete(const std::set<std::string> &Keys);
+
 				/**
 				 * Find and return entry based on the entry name (the key)
 				 * \param EntryName The name (better: the key) of the entry to search
 				 * \return Entry on success, otherwise nullptr
 				 */
-				IniEntryPtr EntryFind(const std::string &EntryName);
+				IniEntryPtr EntryFind(tStringView EntryName) const;
+
+				/**
+				 * Find entry based on the entry name without touching its reference count
+				 * \param EntryName The name (better: the key) of the entry to search
+				 * \return Pointer to the stored entry on success, otherwise nullptr
+				 */
+				const IniEntryPtr *EntryLookup(tStringView EntryName) const;
+
+				/**
+				 * Find entry based on the entry name, keys interned by the pool are compared by ID
+				 * \param EntryName The name (better: the key) of the entry to search
+				 * \param Pool Pool the keys may be interned by, nullptr to compare all characters
+				 * \return Pointer to the stored entry on success, otherwise nullptr
+				 */
+				const IniEntryPtr *EntryLookup(tStringView EntryName, const IniStringPool *Pool) const;
 
 				/**
 				 * Get a list of all keys of this sections
@@ -133,6 +197,30 @@ namespace net
 				 */
 				tListString EntryKeyList(void) const;
 
+				/**
+				 * Invalidate the key handles of all entries, e. g. before the section is dropped
+				 */
+				void HandlesDetach(void);
+
+				/**
+				 * Get the length of the section in the file written last, see YAIP::INIFileSave
+				 * \return Length in bytes
+				 */
+				size_t SavedLengthGet(void) const;
+
+				/**
+				 * Get the position of the section in the file written last, see YAIP::INIFileSave
+				 * \return Offset in bytes, std::string::npos if unknown
+				 */
+				size_t SavedOffsetGet(void) const;
+
+				/**
+				 * Remember where the section has been written to
+				 * \param Offset Offset in bytes, std::string::npos if unknown
+				 * \param Length Length in bytes
+				 */
+				void SavedRangeSet(size_t Offset, size_t Length);
+
 				/**
 				 * Check if section is empty
 				 * \return True if empty otherwise false
@@ -145,6 +233,13 @@ namespace net
 				 */
 				IniEntryList SectionEntriesGet(void) const;
 
+				/**
+				 * Get the entries without copying them, e. g. for range based for loops
+				 * \return List of entries
+				 * \attention The reference is valid as long as the section exists
+				 */
+				const IniEntryList &SectionEntriesView(void) const;
+
 				/**
 				 * Set list of entries
 				 * \param SectionEntries Vector with entries to set
@@ -163,6 +258,12 @@ namespace net
 				 */
 				std::string to_string(void) const override;
 
+				/**
+				 * Append the string representation to a writer without intermediate strings
+				 * \param Writer Writer to append to
+				 */
+				virtual void Write(IniWriter &Writer) const override;
+
 			private:
 				/**
 				 * Section - Regular expression
@@ -187,12 +288,27 @@ namespace net
 				/**
 				 * The comment of the section
 				 */
-				std::string m_SectionComment;
+				IniString m_SectionComment;
 
 				/**
 				 * The name of the section
 				 */
-				std::string m_SectionName;
+				IniString m_SectionName;
+
+				/**
+				 * Flag if name, comment or list of entries modified since the last save
+				 */
+				bool m_Dirty;
+
+				/**
+				 * Length of the section in the file written last
+				 */
+				size_t m_SavedLength;
+
+				/**
+				 * Position of the section in the file written last
+				 */
+				size_t m_SavedOffset;
 			};
 
 			/**
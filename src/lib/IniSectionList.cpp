@@ -40,11 +40,29 @@ namespace net
 		 */
 		namespace yaip
 		{
+			// ******************************************************************
+			// ******************************************************************
+			IniSectionList::IniSectionList(void)
+				: TIniElementList<IniSectionPtr>()
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniSectionList::IniSectionList(const IniMemoryResourcePtr &Resource)
+				: TIniElementList<IniSectionPtr>(Resource)
+			{
+			}
+
 			// ******************************************************************
 			// ******************************************************************
 			void IniSectionList::sort(void)
 			{
-				std::sort(m_Elements.begin(), m_Elements.end(), net::derpaul::yaip::IniSectionCompare);
+				// Saving sorts every time, usually there is nothing to do
+				if (!std::is_sorted(m_Elements.begin(), m_Elements.end(), net::derpaul::yaip::IniSectionCompare))
+				{
+					std::sort(m_Elements.begin(), m_Elements.end(), net::derpaul::yaip::IniSectionCompare);
+				}
 				for (auto CurrentElementPtr = m_Elements.begin(); CurrentElementPtr != m_Elements.end(); ++CurrentElementPtr)
 				{
 					(*CurrentElementPtr)->sort();
@@ -50,6 +50,17 @@ namespace net
 			class IniSectionList : public TIniElementList<IniSectionPtr>
 			{
 			public:
+				/**
+				 * Default constructor, uses the global heap
+				 */
+				IniSectionList(void);
+
+				/**
+				 * Constructor
+				 * \param Resource Resource for the list, nullptr for the global heap
+				 */
+				explicit IniSectionList(const IniMemoryResourcePtr &Resource);
+
 				/**
 				 * We need to sort the own list and also all childs
 				 */
@@ -0,0 +1,128 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniSnapshot.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Immutable version of the INI data for concurrent readers
+ */
+#include "IniSnapshot.h"
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			IniSnapshot::IniSnapshot(const IniSectionList &Sections)
+				: m_Sections()
+			{
+				for (auto const &Section : Sections)
+				{
+					m_Sections.ElementAdd(Section->Clone());
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniSnapshot::~IniSnapshot(void)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			tListString IniSnapshot::SectionKeyListGet(const std::string &Section) const
+			{
+				tListString KeyList;
+
+				const IniSectionPtr *CurrentSection = m_Sections.ElementLookup(Section);
+				if (nullptr != CurrentSection)
+				{
+					KeyList = (*CurrentSection)->EntryKeyList();
+				}
+
+				return KeyList;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			std::string IniSnapshot::SectionKeyValueGet(const std::string &Section, const std::string &Key, const std::string &Default) const
+			{
+				const IniString *Value = ValueFind(Section, Key);
+				return (nullptr == Value) ? Default : Value->str();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			tStringView IniSnapshot::SectionKeyValueView(tStringView Section, tStringView Key, tStringView Default) const
+			{
+				const IniString *Value = ValueFind(Section, Key);
+				if (nullptr != Value)
+				{
+					return tStringView(Value->data(), Value->length());
+				}
+
+				return Default;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			tListString IniSnapshot::SectionListGet(void) const
+			{
+				return m_Sections.ElementIdentifierList();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			std::string IniSnapshot::to_string(void) const
+			{
+				return m_Sections.to_string();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const IniString *IniSnapshot::ValueFind(tStringView Section, tStringView Key) const
+			{
+				const IniSectionPtr *CurrentSection = m_Sections.ElementLookup(Section);
+				if (nullptr != CurrentSection)
+				{
+					const IniEntryPtr *CurrentEntry = (*CurrentSection)->EntryLookup(Key);
+					if ((nullptr != CurrentEntry) && !(*CurrentEntry)->ElementValueGet().empty())
+					{
+						return &((*CurrentEntry)->ElementValueGet());
+					}
+				}
+
+				return nullptr;
+			}
+		}
+	}
+}
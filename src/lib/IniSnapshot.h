@@ -0,0 +1,160 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniSnapshot.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Immutable version of the INI data for concurrent readers
+ */
+#ifndef _INISNAPSHOT_H_
+#define _INISNAPSHOT_H_
+
+#include "Convert.h"
+#include "IniSectionList.h"
+#include <memory>
+#include <string>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			/**
+			 * Immutable deep copy of all sections and entries of a YAIP instance.
+			 * A snapshot is never modified after construction, so any number of
+			 * threads may query it at the same time without locking. It hands out
+			 * values only, never its sections or entries, which readers could modify.
+			 * \see YAIP::SnapshotPublish
+			 */
+			class IniSnapshot
+			{
+			public:
+				/**
+				 * Constructor, copies all sections and entries
+				 * \param Sections Sections to copy
+				 */
+				explicit IniSnapshot(const IniSectionList &Sections);
+
+				/**
+				 * Default destructor
+				 */
+				virtual ~IniSnapshot(void);
+
+				/**
+				 * No copy, share the snapshot using IniSnapshotPtr instead
+				 */
+				IniSnapshot(const IniSnapshot &) = delete;
+
+				/**
+				 * No copy, share the snapshot using IniSnapshotPtr instead
+				 */
+				IniSnapshot &operator=(const IniSnapshot &) = delete;
+
+				/**
+				 * Get all keys of a section
+				 * \param Section Specified section
+				 * \return List with a std::string for each key
+				 */
+				tListString SectionKeyListGet(const std::string &Section) const;
+
+				/**
+				 * Method to retrieve a value of the specified section/key combination for std::string
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \param Default Specified default value in case key does not exist
+				 * \return Returns either the default value or the value of the existing section/key combination
+				 */
+				std::string SectionKeyValueGet(const std::string &Section, const std::string &Key, const std::string &Default) const;
+
+				/**
+				 * Templated method to retrieve a value of the specified section/key combination
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \param Default Specified default value in case key does not exist
+				 * \return Returns either the default value or the value of the existing section/key combination
+				 */
+				template<typename VariableType>
+				VariableType SectionKeyValueGet(const std::string &Section, const std::string &Key, const VariableType &Default) const
+				{
+					VariableType ValueReturn = Default;
+					const IniString *ValueRaw = ValueFind(Section, Key);
+					if ((nullptr != ValueRaw) && !Convert::ConvertTo(ValueRaw->str(), ValueReturn))
+					{
+						ValueReturn = Default;
+					}
+					return ValueReturn;
+				}
+
+				/**
+				 * Method to retrieve a view of the value of the specified section/key combination
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \param Default Specified default value in case key does not exist or is empty
+				 * \return Returns either the default value or a view of the stored value
+				 * \attention The view is valid as long as the snapshot is referenced
+				 */
+				tStringView SectionKeyValueView(tStringView Section, tStringView Key, tStringView Default) const;
+
+				/**
+				 * Get all sections
+				 * \return List with std::strings of section names
+				 */
+				tListString SectionListGet(void) const;
+
+				/**
+				 * String representation of the snapshot
+				 * \return String representation of the whole INI data
+				 */
+				std::string to_string(void) const;
+
+			private:
+				/**
+				 * Copy of all sections
+				 */
+				IniSectionList m_Sections;
+
+				/**
+				 * Find the stored value of a section/key combination
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \return Pointer to the value, nullptr if the key does not exist or the value is empty
+				 */
+				const IniString *ValueFind(tStringView Section, tStringView Key) const;
+			};
+
+			/**
+			 * Convenience typedef for lazy usage of smart_pointers for snapshots
+			 */
+			typedef std::shared_ptr<const IniSnapshot> IniSnapshotPtr;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,202 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniStats.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Counters and latency histograms of YAIP operations
+ */
+#include "IniStats.h"
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			const size_t IniStatsHistogram::BucketCount;
+
+			// ******************************************************************
+			// ******************************************************************
+			uint64_t IniStatsHistogram::PercentileGet(double Percentile) const
+			{
+				if (0 == Count)
+				{
+					return 0;
+				}
+
+				// Rank of the requested duration, at least the first one
+				uint64_t Rank = static_cast<uint64_t>((Percentile / 100.0) * static_cast<double>(Count) + 0.5);
+				if (0 == Rank)
+				{
+					Rank = 1;
+				}
+
+				uint64_t Seen = 0;
+				for (size_t Bucket = 0; Bucket < BucketCount; ++Bucket)
+				{
+					Seen += Buckets[Bucket];
+					if (Seen >= Rank)
+					{
+						uint64_t Bound = static_cast<uint64_t>(1) << (Bucket + 1);
+						return (Bound < MaxNanoseconds) ? Bound : MaxNanoseconds;
+					}
+				}
+
+				return MaxNanoseconds;
+			}
+
+#ifdef YAIP_STATS
+			// ******************************************************************
+			// ******************************************************************
+			IniStatsLatency::IniStatsLatency(void)
+			{
+				Reset();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniStatsLatency::Get(IniStatsHistogram &Histogram) const
+			{
+				Histogram.Count = m_Count.load(std::memory_order_relaxed);
+				Histogram.TotalNanoseconds = m_Total.load(std::memory_order_relaxed);
+				Histogram.MaxNanoseconds = m_Max.load(std::memory_order_relaxed);
+				for (size_t Bucket = 0; Bucket < IniStatsHistogram::BucketCount; ++Bucket)
+				{
+					Histogram.Buckets[Bucket] = m_Buckets[Bucket].load(std::memory_order_relaxed);
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniStatsLatency::Record(uint64_t Nanoseconds)
+			{
+				// Index of the highest bit set, durations below 2 ns end in the first bucket
+				size_t Bucket = 0;
+				for (uint64_t Value = Nanoseconds >> 1; (0 != Value) && (Bucket < IniStatsHistogram::BucketCount - 1); Value >>= 1)
+				{
+					++Bucket;
+				}
+
+				m_Count.fetch_add(1, std::memory_order_relaxed);
+				m_Total.fetch_add(Nanoseconds, std::memory_order_relaxed);
+				m_Buckets[Bucket].fetch_add(1, std::memory_order_relaxed);
+
+				uint64_t Max = m_Max.load(std::memory_order_relaxed);
+				while ((Max < Nanoseconds) && !m_Max.compare_exchange_weak(Max, Nanoseconds, std::memory_order_relaxed))
+				{
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniStatsLatency::Reset(void)
+			{
+				m_Count.store(0, std::memory_order_relaxed);
+				m_Total.store(0, std::memory_order_relaxed);
+				m_Max.store(0, std::memory_order_relaxed);
+				for (auto &Bucket : m_Buckets)
+				{
+					Bucket.store(0, std::memory_order_relaxed);
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const bool IniStats::Enabled;
+
+			// ******************************************************************
+			// ******************************************************************
+			IniStats::IniStats(void)
+			{
+				Reset();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniStats::IniStats(const IniStats &)
+			{
+				Reset();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniStats &IniStats::operator=(const IniStats &)
+			{
+				return *this;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniStats::Reset(void)
+			{
+				m_Lookups.store(0, std::memory_order_relaxed);
+				m_LookupHits.store(0, std::memory_order_relaxed);
+				m_LookupMisses.store(0, std::memory_order_relaxed);
+				m_Sets.store(0, std::memory_order_relaxed);
+				m_Deletes.store(0, std::memory_order_relaxed);
+				m_Conversions.store(0, std::memory_order_relaxed);
+				m_ConversionFailures.store(0, std::memory_order_relaxed);
+				for (auto &Latency : m_Latency)
+				{
+					Latency.Reset();
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniStatsSnapshot IniStats::SnapshotGet(void) const
+			{
+				IniStatsSnapshot Snapshot;
+
+				Snapshot.Lookups = m_Lookups.load(std::memory_order_relaxed);
+				Snapshot.LookupHits = m_LookupHits.load(std::memory_order_relaxed);
+				Snapshot.LookupMisses = m_LookupMisses.load(std::memory_order_relaxed);
+				Snapshot.Sets = m_Sets.load(std::memory_order_relaxed);
+				Snapshot.Deletes = m_Deletes.load(std::memory_order_relaxed);
+				Snapshot.Conversions = m_Conversions.load(std::memory_order_relaxed);
+				Snapshot.ConversionFailures = m_ConversionFailures.load(std::memory_order_relaxed);
+				m_Latency[static_cast<size_t>(IniStatsPhase::Get)].Get(Snapshot.GetLatency);
+				m_Latency[static_cast<size_t>(IniStatsPhase::Set)].Get(Snapshot.SetLatency);
+				m_Latency[static_cast<size_t>(IniStatsPhase::Load)].Get(Snapshot.LoadDuration);
+				m_Latency[static_cast<size_t>(IniStatsPhase::Parse)].Get(Snapshot.ParseDuration);
+				m_Latency[static_cast<size_t>(IniStatsPhase::Save)].Get(Snapshot.SaveDuration);
+
+				return Snapshot;
+			}
+#else
+			// ******************************************************************
+			// ******************************************************************
+			const bool IniStats::Enabled;
+#endif
+		}
+	}
+}
@@ -0,0 +1,491 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniStats.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Counters and latency histograms of YAIP operations
+ */
+#ifndef _INISTATS_H_
+#define _INISTATS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef YAIP_STATS
+#include <atomic>
+#include <chrono>
+#endif
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			/**
+			 * Operations with a latency histogram
+			 */
+			enum class IniStatsPhase
+			{
+				/**
+				 * SectionKeyValueGet and SectionKeyValueView
+				 */
+				Get,
+
+				/**
+				 * SectionKeyValueSet
+				 */
+				Set,
+
+				/**
+				 * INIFileLoad including parsing
+				 */
+				Load,
+
+				/**
+				 * Parsing of the file content
+				 */
+				Parse,
+
+				/**
+				 * INIFileSave
+				 */
+				Save
+			};
+
+			/**
+			 * Latency histogram with logarithmic buckets
+			 */
+			struct IniStatsHistogram
+			{
+				/**
+				 * Number of buckets, bucket N counts durations from 2^N up to 2^(N+1) nanoseconds
+				 */
+				static const size_t BucketCount = 40;
+
+				/**
+				 * Number of recorded durations
+				 */
+				uint64_t Count = 0;
+
+				/**
+				 * Sum of all durations in nanoseconds
+				 */
+				uint64_t TotalNanoseconds = 0;
+
+				/**
+				 * Longest duration in nanoseconds
+				 */
+				uint64_t MaxNanoseconds = 0;
+
+				/**
+				 * Number of durations per bucket
+				 */
+				uint64_t Buckets[BucketCount] = {};
+
+				/**
+				 * Estimate a percentile from the buckets
+				 * \param Percentile Percentile between 0.0 and 100.0
+				 * \return Upper bound of the bucket holding the percentile in nanoseconds, 0 if empty
+				 */
+				uint64_t PercentileGet(double Percentile) const;
+			};
+
+			/**
+			 * Values of all counters and histograms at the time of YAIP::StatsGet
+			 */
+			struct IniStatsSnapshot
+			{
+				/**
+				 * Number of lookups of a section/key combination
+				 */
+				uint64_t Lookups = 0;
+
+				/**
+				 * Lookups of existing keys with a value
+				 */
+				uint64_t LookupHits = 0;
+
+				/**
+				 * Lookups of missing keys or empty values
+				 */
+				uint64_t LookupMisses = 0;
+
+				/**
+				 * Number of values set
+				 */
+				uint64_t Sets = 0;
+
+				/**
+				 * Number of keys deleted
+				 */
+				uint64_t Deletes = 0;
+
+				/**
+				 * Number of conversions from and to std::string
+				 */
+				uint64_t Conversions = 0;
+
+				/**
+				 * Number of failed conversions
+				 */
+				uint64_t ConversionFailures = 0;
+
+				/**
+				 * Latency of SectionKeyValueGet and SectionKeyValueView
+				 */
+				IniStatsHistogram GetLatency;
+
+				/**
+				 * Latency of SectionKeyValueSet
+				 */
+				IniStatsHistogram SetLatency;
+
+				/**
+				 * Duration of INIFileLoad
+				 */
+				IniStatsHistogram LoadDuration;
+
+				/**
+				 * Duration of parsing the file content
+				 */
+				IniStatsHistogram ParseDuration;
+
+				/**
+				 * Duration of INIFileSave
+				 */
+				IniStatsHistogram SaveDuration;
+			};
+
+#ifdef YAIP_STATS
+			/**
+			 * Histogram updated with relaxed atomics, safe to read from other threads
+			 */
+			class IniStatsLatency
+			{
+			public:
+				/**
+				 * Default constructor
+				 */
+				IniStatsLatency(void);
+
+				/**
+				 * Copy the current values
+				 * \param Histogram Receives the values
+				 */
+				void Get(IniStatsHistogram &Histogram) const;
+
+				/**
+				 * Record a duration
+				 * \param Nanoseconds Duration in nanoseconds
+				 */
+				void Record(uint64_t Nanoseconds);
+
+				/**
+				 * Set all values to zero
+				 */
+				void Reset(void);
+
+			private:
+				/**
+				 * Number of recorded durations
+				 */
+				std::atomic<uint64_t> m_Count;
+
+				/**
+				 * Sum of all durations
+				 */
+				std::atomic<uint64_t> m_Total;
+
+				/**
+				 * Longest duration
+				 */
+				std::atomic<uint64_t> m_Max;
+
+				/**
+				 * Number of durations per bucket
+				 */
+				std::atomic<uint64_t> m_Buckets[IniStatsHistogram::BucketCount];
+			};
+
+			/**
+			 * Counters and histograms of a YAIP instance. Built with YAIP_STATS all
+			 * values are updated with relaxed atomics, otherwise all methods are empty
+			 * and the compiler removes every call.
+			 */
+			class IniStats
+			{
+			public:
+				/**
+				 * Flag if statistics are compiled in
+				 */
+				static const bool Enabled = true;
+
+				/**
+				 * Default constructor
+				 */
+				IniStats(void);
+
+				/**
+				 * A copy starts with all values at zero
+				 */
+				IniStats(const IniStats &);
+
+				/**
+				 * Assignment keeps the own values
+				 * \return This instance
+				 */
+				IniStats &operator=(const IniStats &);
+
+				/**
+				 * Count a conversion
+				 * \param Success Result of the conversion
+				 */
+				void ConversionCount(bool Success)
+				{
+					m_Conversions.fetch_add(1, std::memory_order_relaxed);
+					if (!Success)
+					{
+						m_ConversionFailures.fetch_add(1, std::memory_order_relaxed);
+					}
+				}
+
+				/**
+				 * Count deleted keys
+				 * \param Count Number of deleted keys
+				 */
+				void DeleteCount(size_t Count = 1)
+				{
+					m_Deletes.fetch_add(Count, std::memory_order_relaxed);
+				}
+
+				/**
+				 * Count a lookup
+				 * \param Hit true if the key has a value
+				 */
+				void LookupCount(bool Hit)
+				{
+					m_Lookups.fetch_add(1, std::memory_order_relaxed);
+					(Hit ? m_LookupHits : m_LookupMisses).fetch_add(1, std::memory_order_relaxed);
+				}
+
+				/**
+				 * Histogram of a phase
+				 * \param Phase Phase to get
+				 * \return The histogram
+				 */
+				IniStatsLatency &LatencyGet(IniStatsPhase Phase)
+				{
+					return m_Latency[static_cast<size_t>(Phase)];
+				}
+
+				/**
+				 * Set all values to zero
+				 */
+				void Reset(void);
+
+				/**
+				 * Count a set value
+				 */
+				void SetCount(void)
+				{
+					m_Sets.fetch_add(1, std::memory_order_relaxed);
+				}
+
+				/**
+				 * Copy all values
+				 * \return Current values
+				 */
+				IniStatsSnapshot SnapshotGet(void) const;
+
+			private:
+				/**
+				 * Number of lookups
+				 */
+				std::atomic<uint64_t> m_Lookups;
+
+				/**
+				 * Number of lookups with a value
+				 */
+				std::atomic<uint64_t> m_LookupHits;
+
+				/**
+				 * Number of lookups without a value
+				 */
+				std::atomic<uint64_t> m_LookupMisses;
+
+				/**
+				 * Number of values set
+				 */
+				std::atomic<uint64_t> m_Sets;
+
+				/**
+				 * Number of keys deleted
+				 */
+				std::atomic<uint64_t> m_Deletes;
+
+				/**
+				 * Number of conversions
+				 */
+				std::atomic<uint64_t> m_Conversions;
+
+				/**
+				 * Number of failed conversions
+				 */
+				std::atomic<uint64_t> m_ConversionFailures;
+
+				/**
+				 * Histograms in order of IniStatsPhase
+				 */
+				IniStatsLatency m_Latency[5];
+			};
+
+			/**
+			 * Measures the lifetime of a scope and records it in the histogram of a phase
+			 */
+			class IniStatsTimer
+			{
+			public:
+				/**
+				 * Constructor, starts measuring
+				 * \param Stats Statistics to record into
+				 * \param Phase Phase to record
+				 */
+				IniStatsTimer(IniStats &Stats, IniStatsPhase Phase)
+					: m_Latency(Stats.LatencyGet(Phase))
+					, m_Start(std::chrono::steady_clock::now())
+				{
+				}
+
+				/**
+				 * Destructor, records the duration
+				 */
+				~IniStatsTimer(void)
+				{
+					m_Latency.Record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_Start).count()));
+				}
+
+			private:
+				/**
+				 * Histogram to record into
+				 */
+				IniStatsLatency &m_Latency;
+
+				/**
+				 * Start of the measurement
+				 */
+				std::chrono::steady_clock::time_point m_Start;
+			};
+#else
+			/**
+			 * Statistics are not compiled in, all methods are empty and removed by the compiler
+			 */
+			class IniStats
+			{
+			public:
+				/**
+				 * Flag if statistics are compiled in
+				 */
+				static const bool Enabled = false;
+
+				/**
+				 * Count a conversion
+				 * \param Success Result of the conversion
+				 */
+				void ConversionCount(bool Success)
+				{
+					(void)Success;
+				}
+
+				/**
+				 * Count deleted keys
+				 * \param Count Number of deleted keys
+				 */
+				void DeleteCount(size_t Count = 1)
+				{
+					(void)Count;
+				}
+
+				/**
+				 * Count a lookup
+				 * \param Hit true if the key has a value
+				 */
+				void LookupCount(bool Hit)
+				{
+					(void)Hit;
+				}
+
+				/**
+				 * Set all values to zero
+				 */
+				void Reset(void)
+				{
+				}
+
+				/**
+				 * Count a set value
+				 */
+				void SetCount(void)
+				{
+				}
+
+				/**
+				 * All values are zero
+				 * \return Empty values
+				 */
+				IniStatsSnapshot SnapshotGet(void) const
+				{
+					return IniStatsSnapshot();
+				}
+			};
+
+			/**
+			 * Statistics are not compiled in, nothing is measured
+			 */
+			class IniStatsTimer
+			{
+			public:
+				/**
+				 * Constructor
+				 * \param Stats Statistics to record into
+				 * \param Phase Phase to record
+				 */
+				IniStatsTimer(IniStats &Stats, IniStatsPhase Phase)
+				{
+					(void)Stats;
+					(void)Phase;
+				}
+			};
+#endif
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,286 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+
+/**
+ * \file	IniString.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	String of names, values and comments, owned or shared
+ */
+#include "IniString.h"
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			// Check if memory of one resource can be returned to the other, nullptr is the global heap
+			static bool ResourceEqual(const IniMemoryResource *Left, const IniMemoryResource *Right)
+			{
+				const IniMemoryResource &LeftResource = (nullptr != Left) ? *Left : *IniMemoryResource::DefaultGet();
+				const IniMemoryResource &RightResource = (nullptr != Right) ? *Right : *IniMemoryResource::DefaultGet();
+				return (&LeftResource == &RightResource) || LeftResource.IsEqual(RightResource);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const size_t IniString::LocalCapacity;
+
+			// ******************************************************************
+			// ******************************************************************
+			IniString::IniString(void)
+				: IniString(nullptr)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniString::IniString(IniMemoryResource *Resource)
+				: m_Length(0)
+				, m_Capacity(LocalCapacity)
+				, m_Resource(Resource)
+			{
+				m_Local[0] = '\0';
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniString::IniString(const IniString &Other)
+				: IniString()
+			{
+				assign(Other.data(), Other.length());
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniString::IniString(IniString &&Other)
+				: IniString(Other.m_Resource)
+			{
+				Steal(Other);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniString::~IniString(void)
+			{
+				Release();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniString &IniString::operator=(const IniString &Other)
+			{
+				if (this != &Other)
+				{
+					assign(Other.data(), Other.length());
+				}
+
+				return *this;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniString &IniString::operator=(IniString &&Other)
+			{
+				if (this == &Other)
+				{
+					return *this;
+				}
+
+				// A buffer can only be taken over if it is returned to an interchangeable resource
+				bool OwnBuffer = (0 != Other.m_Capacity) && (LocalCapacity != Other.m_Capacity);
+				if (OwnBuffer && !ResourceEqual(m_Resource, Other.m_Resource))
+				{
+					assign(Other.data(), Other.length());
+					Other.clear();
+				}
+				else
+				{
+					Release();
+					Steal(Other);
+				}
+
+				return *this;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniString::assign(const char *Data, size_t Length)
+			{
+				if (Length >= std::numeric_limits<uint32_t>::max())
+				{
+					throw std::length_error("IniString too long");
+				}
+
+				// Reuse the own characters, the range may be part of them
+				if ((0 != m_Capacity) && (Length <= m_Capacity))
+				{
+					char *Target = (LocalCapacity == m_Capacity) ? m_Local : m_Heap;
+					memmove(Target, Data, Length);
+					Target[Length] = '\0';
+					m_Length = static_cast<uint32_t>(Length);
+					return;
+				}
+
+				// Shared characters stay valid while they are copied in place
+				if (Length <= LocalCapacity)
+				{
+					memmove(m_Local, Data, Length);
+					m_Local[Length] = '\0';
+					m_Length = static_cast<uint32_t>(Length);
+					m_Capacity = LocalCapacity;
+					return;
+				}
+
+				// Copy before the old buffer is released, the range may be part of it
+				char *Buffer = BufferAllocate(Length);
+				memcpy(Buffer, Data, Length);
+				Buffer[Length] = '\0';
+				Release();
+				m_Heap = Buffer;
+				m_Length = static_cast<uint32_t>(Length);
+				m_Capacity = static_cast<uint32_t>(Length);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniString::assign(tStringView Text)
+			{
+				assign(Text.data(), Text.length());
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniString::clear(void)
+			{
+				if (0 == m_Capacity)
+				{
+					m_Capacity = LocalCapacity;
+					m_Local[0] = '\0';
+				}
+				else
+				{
+					((LocalCapacity == m_Capacity) ? m_Local : m_Heap)[0] = '\0';
+				}
+				m_Length = 0;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniString::Share(const char *Data, size_t Length, const void *Owner)
+			{
+				if (Length >= std::numeric_limits<uint32_t>::max())
+				{
+					throw std::length_error("IniString too long");
+				}
+
+				Release();
+				m_Shared.Data = Data;
+				m_Shared.Owner = Owner;
+				m_Length = static_cast<uint32_t>(Length);
+				m_Capacity = 0;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			std::string IniString::str(void) const
+			{
+				return std::string(data(), m_Length);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniString::operator std::string(void) const
+			{
+				return str();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			char *IniString::BufferAllocate(size_t Capacity) const
+			{
+				if (nullptr != m_Resource)
+				{
+					return static_cast<char *>(m_Resource->Allocate(Capacity + 1, 1));
+				}
+
+				return static_cast<char *>(::operator new(Capacity + 1));
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniString::BufferDeallocate(char *Buffer, size_t Capacity) const
+			{
+				if (nullptr != m_Resource)
+				{
+					m_Resource->Deallocate(Buffer, Capacity + 1, 1);
+				}
+				else
+				{
+					::operator delete(Buffer);
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniString::Release(void)
+			{
+				if ((0 != m_Capacity) && (LocalCapacity != m_Capacity))
+				{
+					BufferDeallocate(m_Heap, m_Capacity);
+				}
+
+				m_Length = 0;
+				m_Capacity = LocalCapacity;
+				m_Local[0] = '\0';
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniString::Steal(IniString &Other)
+			{
+				// The characters are either in place or referred to by pointers, copying all bytes moves both
+				static_assert(sizeof(tShared) <= sizeof(m_Local), "Pointers do not fit in place");
+				memcpy(m_Local, Other.m_Local, sizeof(m_Local));
+				m_Length = Other.m_Length;
+				m_Capacity = Other.m_Capacity;
+
+				Other.m_Length = 0;
+				Other.m_Capacity = LocalCapacity;
+				Other.m_Local[0] = '\0';
+			}
+		}
+	}
+}
@@ -0,0 +1,448 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+
+/**
+ * \file	IniString.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	String of names, values and comments, owned or shared
+ */
+#ifndef _INISTRING_H_
+#define _INISTRING_H_
+
+#include "IniMemoryResource.h"
+#include "string_extensions.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			/**
+			 * String of a name, value or comment. Short strings are stored in place,
+			 * longer ones in a buffer of their own taken from a memory resource. Instead
+			 * of own characters a string can refer to immutable characters of an owner,
+			 * e. g. an IniStringPool, see Share. Converts to std::string for the public
+			 * interface.
+			 */
+			class IniString
+			{
+			public:
+				/**
+				 * Number of characters stored in place without a buffer
+				 */
+				static const size_t LocalCapacity = 15;
+
+				/**
+				 * Default constructor, empty string using the global heap
+				 */
+				IniString(void);
+
+				/**
+				 * Constructor, empty string
+				 * \param Resource Resource for the buffer, nullptr for the global heap
+				 * \attention The resource must outlive the string, e. g. allocate the owner of the string from it
+				 */
+				explicit IniString(IniMemoryResource *Resource);
+
+				/**
+				 * Copy constructor, the copy owns its characters on the global heap even if the original is
+				 * shared or allocated from a resource. The resource is not propagated, the string does not
+				 * own it and a copy, e. g. in a snapshot, may outlive it.
+				 * \param Other String to copy
+				 */
+				IniString(const IniString &Other);
+
+				/**
+				 * Move constructor, takes over buffer, resource or shared characters
+				 * \param Other String to move, empty afterwards
+				 */
+				IniString(IniString &&Other);
+
+				/**
+				 * Default destructor
+				 */
+				~IniString(void);
+
+				/**
+				 * Assignment, takes over a copy of the characters even if the other string is shared.
+				 * The string keeps its resource.
+				 * \param Other String to copy
+				 * \return This string
+				 */
+				IniString &operator=(const IniString &Other);
+
+				/**
+				 * Move assignment, takes over buffer or shared characters. The string keeps its
+				 * resource, a buffer of another resource is copied.
+				 * \param Other String to move, empty afterwards
+				 * \return This string
+				 */
+				IniString &operator=(IniString &&Other);
+
+				/**
+				 * Replace the characters by a copy of a range, the range may be part of this string
+				 * \param Data Start of range
+				 * \param Length Length of range
+				 */
+				void assign(const char *Data, size_t Length);
+
+				/**
+				 * Replace the characters by a copy of a view
+				 * \param Text View to copy
+				 */
+				void assign(tStringView Text);
+
+				/**
+				 * Zero terminated characters
+				 * \return Start of characters
+				 */
+				const char *c_str(void) const
+				{
+					return data();
+				}
+
+				/**
+				 * Make the string empty
+				 */
+				void clear(void);
+
+				/**
+				 * Start of the characters, zero terminated
+				 * \return Start of characters
+				 */
+				const char *data(void) const
+				{
+					return (0 == m_Capacity) ? m_Shared.Data : ((LocalCapacity == m_Capacity) ? m_Local : m_Heap);
+				}
+
+				/**
+				 * Check for empty string
+				 * \return true if empty otherwise false
+				 */
+				bool empty(void) const
+				{
+					return 0 == m_Length;
+				}
+
+				/**
+				 * Check if the characters are owned by someone else, see Share
+				 * \return true if shared otherwise false
+				 */
+				bool IsShared(void) const
+				{
+					return 0 == m_Capacity;
+				}
+
+				/**
+				 * Check if the characters are shared by a certain owner, see Share
+				 * \param Owner Owner to check
+				 * \return true if shared by Owner otherwise false
+				 */
+				bool IsSharedBy(const void *Owner) const
+				{
+					return (0 == m_Capacity) && (Owner == m_Shared.Owner);
+				}
+
+				/**
+				 * Length of the string
+				 * \return Number of characters
+				 */
+				size_t length(void) const
+				{
+					return m_Length;
+				}
+
+				/**
+				 * Get the resource of the buffer
+				 * \return The resource, nullptr for the global heap
+				 */
+				IniMemoryResource *ResourceGet(void) const
+				{
+					return m_Resource;
+				}
+
+				/**
+				 * Refer to immutable characters instead of own ones
+				 * \param Data Start of characters, zero terminated
+				 * \param Length Number of characters
+				 * \param Owner Owner of the characters, e. g. to compare by address, see IsSharedBy
+				 * \attention The characters must outlive the string or its next modification
+				 */
+				void Share(const char *Data, size_t Length, const void *Owner);
+
+				/**
+				 * Length of the string
+				 * \return Number of characters
+				 */
+				size_t size(void) const
+				{
+					return m_Length;
+				}
+
+				/**
+				 * Copy of the string
+				 * \return Copy of the characters
+				 */
+				std::string str(void) const;
+
+				/**
+				 * View of the characters without copying them
+				 * \return View of the characters
+				 */
+				tStringView view(void) const
+				{
+					return tStringView(data(), m_Length);
+				}
+
+				/**
+				 * Copy of the string, e. g. to assign it to a std::string
+				 * \return Copy of the characters
+				 */
+				operator std::string(void) const;
+
+				/**
+				 * View of the characters, e. g. to pass the string as a section or key name
+				 * \return View of the characters
+				 */
+				operator tStringView(void) const
+				{
+					return view();
+				}
+
+			private:
+				/**
+				 * Characters of an owner, see Share
+				 */
+				struct tShared
+				{
+					/**
+					 * Start of characters
+					 */
+					const char *Data;
+
+					/**
+					 * Owner of the characters
+					 */
+					const void *Owner;
+				};
+
+				/**
+				 * Number of characters
+				 */
+				uint32_t m_Length;
+
+				/**
+				 * Characters the buffer can hold, LocalCapacity if stored in place, 0 if shared
+				 */
+				uint32_t m_Capacity;
+
+				/**
+				 * The characters, depending on m_Capacity
+				 */
+				union
+				{
+					/**
+					 * Shared characters
+					 */
+					tShared m_Shared;
+
+					/**
+					 * Own buffer
+					 */
+					char *m_Heap;
+
+					/**
+					 * Characters stored in place
+					 */
+					char m_Local[LocalCapacity + 1];
+				};
+
+				/**
+				 * Resource of the own buffer, nullptr for the global heap
+				 */
+				IniMemoryResource *m_Resource;
+
+				/**
+				 * Get a buffer from the resource
+				 * \param Capacity Number of characters without terminating zero
+				 * \return The buffer
+				 */
+				char *BufferAllocate(size_t Capacity) const;
+
+				/**
+				 * Return a buffer to the resource
+				 * \param Buffer Buffer returned by BufferAllocate
+				 * \param Capacity Capacity passed to BufferAllocate
+				 */
+				void BufferDeallocate(char *Buffer, size_t Capacity) const;
+
+				/**
+				 * Release the own buffer and become an empty string stored in place
+				 */
+				void Release(void);
+
+				/**
+				 * Take over the characters of another string
+				 * \param Other String to take over, empty afterwards
+				 */
+				void Steal(IniString &Other);
+			};
+
+			/**
+			 * Compare two strings for equal content
+			 * \param Left Left string
+			 * \param Right Right string
+			 * \return true on equal content, otherwise false
+			 */
+			inline bool operator==(const IniString &Left, const IniString &Right)
+			{
+				return (Left.length() == Right.length()) && (0 == memcmp(Left.data(), Right.data(), Left.length()));
+			}
+
+			/**
+			 * Compare a string with a zero terminated string
+			 * \param Left Left string
+			 * \param Right Right string
+			 * \return true on equal content, otherwise false
+			 */
+			inline bool operator==(const IniString &Left, const char *Right)
+			{
+				return 0 == strcmp(Left.c_str(), Right);
+			}
+
+			/**
+			 * Compare a zero terminated string with a string
+			 * \param Left Left string
+			 * \param Right Right string
+			 * \return true on equal content, otherwise false
+			 */
+			inline bool operator==(const char *Left, const IniString &Right)
+			{
+				return Right == Left;
+			}
+
+			/**
+			 * Compare a string with a std::string
+			 * \param Left Left string
+			 * \param Right Right string
+			 * \return true on equal content, otherwise false
+			 */
+			inline bool operator==(const IniString &Left, const std::string &Right)
+			{
+				return (Left.length() == Right.length()) && (0 == memcmp(Left.data(), Right.data(), Left.length()));
+			}
+
+			/**
+			 * Compare a std::string with a string
+			 * \param Left Left string
+			 * \param Right Right string
+			 * \return true on equal content, otherwise false
+			 */
+			inline bool operator==(const std::string &Left, const IniString &Right)
+			{
+				return Right == Left;
+			}
+
+			/**
+			 * Compare two strings for different content
+			 * \param Left Left string
+			 * \param Right Right string
+			 * \return true on different content, otherwise false
+			 */
+			inline bool operator!=(const IniString &Left, const IniString &Right)
+			{
+				return !(Left == Right);
+			}
+
+			/**
+			 * Compare a string with a zero terminated string
+			 * \param Left Left string
+			 * \param Right Right string
+			 * \return true on different content, otherwise false
+			 */
+			inline bool operator!=(const IniString &Left, const char *Right)
+			{
+				return !(Left == Right);
+			}
+
+			/**
+			 * Compare a zero terminated string with a string
+			 * \param Left Left string
+			 * \param Right Right string
+			 * \return true on different content, otherwise false
+			 */
+			inline bool operator!=(const char *Left, const IniString &Right)
+			{
+				return !(Right == Left);
+			}
+
+			/**
+			 * Compare a string with a std::string
+			 * \param Left Left string
+			 * \param Right Right string
+			 * \return true on different content, otherwise false
+			 */
+			inline bool operator!=(const IniString &Left, const std::string &Right)
+			{
+				return !(Left == Right);
+			}
+
+			/**
+			 * Compare a std::string with a string
+			 * \param Left Left string
+			 * \param Right Right string
+			 * \return true on different content, otherwise false
+			 */
+			inline bool operator!=(const std::string &Left, const IniString &Right)
+			{
+				return !(Right == Left);
+			}
+
+			/**
+			 * Write a string to a stream
+			 * \param Stream Stream to write to
+			 * \param Text String to write
+			 * \return The stream
+			 */
+			inline std::ostream &operator<<(std::ostream &Stream, const IniString &Text)
+			{
+				return Stream.write(Text.data(), static_cast<std::streamsize>(Text.length()));
+			}
+		}
+	}
+}
+
+#endif
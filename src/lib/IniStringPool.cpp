@@ -0,0 +1,165 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniStringPool.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Table of interned keys and values shared by the entries of an instance
+ */
+#include "IniStringPool.h"
+#include <cstring>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			IniStringPool::IniStringPool(void)
+				: IniStringPool(nullptr)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			// Size of the blocks of characters taken from the upstream
+			static const size_t CharactersBlockSize = 4096;
+
+			// ******************************************************************
+			// ******************************************************************
+			IniStringPool::IniStringPool(const IniMemoryResourcePtr &Upstream)
+				: m_Upstream((nullptr != Upstream) ? Upstream : IniMemoryResource::DefaultGet())
+				, m_Characters(CharactersBlockSize, m_Upstream)
+				, m_Index(0, std::hash<size_t>(), std::equal_to<size_t>(), IniAllocator<std::pair<const size_t, tStringView>>(m_Upstream))
+				, m_Bytes(0)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void *IniStringPool::Allocate(size_t Size, size_t Alignment)
+			{
+				return m_Upstream->Allocate(Size, Alignment);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniStringPool::BytesGet(void) const
+			{
+				return m_Bytes;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniStringPool::Contains(const IniString &Text) const
+			{
+				return Text.IsSharedBy(this);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniStringPool::Deallocate(void *Memory, size_t Size, size_t Alignment)
+			{
+				m_Upstream->Deallocate(Memory, Size, Alignment);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			tStringView IniStringPool::Find(tStringView Text) const
+			{
+				const tStringView *Interned = IndexFind(strhash(Text.data(), Text.length()), Text);
+				return (nullptr != Interned) ? *Interned : tStringView(nullptr, 0);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const char *IniStringPool::IdFind(size_t Hash, tStringView Text) const
+			{
+				const tStringView *Interned = IndexFind(Hash, Text);
+				return (nullptr != Interned) ? Interned->data() : nullptr;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const tStringView *IniStringPool::IndexFind(size_t Hash, tStringView Text) const
+			{
+				auto Range = m_Index.equal_range(Hash);
+				for (auto it = Range.first; it != Range.second; ++it)
+				{
+					const tStringView &Interned = it->second;
+					if ((Interned.length() == Text.length()) && (0 == memcmp(Interned.data(), Text.data(), Text.length())))
+					{
+						return &Interned;
+					}
+				}
+
+				return nullptr;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			tStringView IniStringPool::Intern(tStringView Text)
+			{
+				size_t Hash = strhash(Text.data(), Text.length());
+				const tStringView *Interned = IndexFind(Hash, Text);
+				if (nullptr != Interned)
+				{
+					return *Interned;
+				}
+
+				// Zero terminated, see IniString::Share
+				char *Characters = static_cast<char *>(m_Characters.Allocate(Text.length() + 1, 1));
+				memcpy(Characters, Text.data(), Text.length());
+				Characters[Text.length()] = '\0';
+
+				tStringView Added(Characters, Text.length());
+				m_Index.insert(std::make_pair(Hash, Added));
+				m_Bytes += Text.length();
+				return Added;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniStringPool::Intern(tStringView Text, IniString &Target)
+			{
+				tStringView Interned = Intern(Text);
+				Target.Share(Interned.data(), Interned.length(), this);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniStringPool::SizeGet(void) const
+			{
+				return m_Index.size();
+			}
+		}
+	}
+}
@@ -0,0 +1,193 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniStringPool.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Table of interned keys and values shared by the entries of an instance
+ */
+#ifndef _INISTRINGPOOL_H_
+#define _INISTRINGPOOL_H_
+
+#include "IniArena.h"
+#include "IniMemoryResource.h"
+#include "IniString.h"
+#include "string_extensions.h"
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			/**
+			 * Stores each distinct string once, equal strings are interned to the same
+			 * address. The characters and the index are taken from the upstream. The pool
+			 * is also a memory resource passing all allocations to its upstream: entries
+			 * allocated from the pool keep it, and thereby the strings they point to, alive.
+			 * \attention Not thread safe
+			 */
+			class IniStringPool : public IniMemoryResource
+			{
+			public:
+				/**
+				 * Constructor, memory is taken from the global heap
+				 */
+				IniStringPool(void);
+
+				/**
+				 * Constructor
+				 * \param Upstream Resource to pass allocations to, nullptr for the global heap
+				 */
+				explicit IniStringPool(const IniMemoryResourcePtr &Upstream);
+
+				/**
+				 * No copy, entries point into the pool
+				 */
+				IniStringPool(const IniStringPool &) = delete;
+
+				/**
+				 * No copy, entries point into the pool
+				 */
+				IniStringPool &operator=(const IniStringPool &) = delete;
+
+				/**
+				 * Get memory from the upstream
+				 * \param Size Number of bytes
+				 * \param Alignment Required alignment, a power of two
+				 * \return Pointer to memory
+				 */
+				virtual void *Allocate(size_t Size, size_t Alignment) override;
+
+				/**
+				 * Number of characters of all interned strings
+				 * \return Number of characters
+				 */
+				size_t BytesGet(void) const;
+
+				/**
+				 * Check if a string refers to an interned instance of this pool
+				 * \param Text String to check
+				 * \return true if interned by this pool, false for any other string, even an equal one
+				 */
+				bool Contains(const IniString &Text) const;
+
+				/**
+				 * Return memory to the upstream
+				 * \param Memory Pointer returned by Allocate
+				 * \param Size Number of bytes passed to Allocate
+				 * \param Alignment Alignment passed to Allocate
+				 */
+				virtual void Deallocate(void *Memory, size_t Size, size_t Alignment) override;
+
+				/**
+				 * Find the interned instance of a string
+				 * \param Text String to find
+				 * \return The interned string, zero terminated, an empty view with nullptr as data if not interned
+				 */
+				tStringView Find(tStringView Text) const;
+
+				/**
+				 * Find the ID of an interned string, the address of its characters. Strings
+				 * interned by this pool are equal if and only if their IDs are equal.
+				 * \param Hash Hash of the string, see strhash
+				 * \param Text String to find
+				 * \return ID of the string, nullptr if not interned
+				 */
+				const char *IdFind(size_t Hash, tStringView Text) const;
+
+				/**
+				 * Get the interned instance of a string, add it if required
+				 * \param Text String to intern
+				 * \return The interned string, zero terminated, valid as long as the pool exists
+				 */
+				tStringView Intern(tStringView Text);
+
+				/**
+				 * Let a string refer to the interned instance of a string, add it if required
+				 * \param Text String to intern, may be part of Target
+				 * \param Target String to refer to the interned instance
+				 * \attention Target must not outlive the pool, e. g. allocate its owner from the pool
+				 */
+				void Intern(tStringView Text, IniString &Target);
+
+				/**
+				 * Number of distinct strings
+				 * \return Number of strings
+				 */
+				size_t SizeGet(void) const;
+
+			private:
+				/**
+				 * Hash index of the interned strings, allocated from the upstream
+				 */
+				typedef std::unordered_multimap<size_t, tStringView, std::hash<size_t>, std::equal_to<size_t>, IniAllocator<std::pair<const size_t, tStringView>>> tIndex;
+
+				/**
+				 * Resource all allocations are passed to
+				 */
+				IniMemoryResourcePtr m_Upstream;
+
+				/**
+				 * The characters, a string is never released before the pool
+				 */
+				IniArena m_Characters;
+
+				/**
+				 * Hash of a string to the string
+				 */
+				tIndex m_Index;
+
+				/**
+				 * Number of characters of all strings
+				 */
+				size_t m_Bytes;
+
+				/**
+				 * Find the interned instance of a string by its hash
+				 * \param Hash Hash of the string, see strhash
+				 * \param Text String to find
+				 * \return The interned string, nullptr if not interned
+				 */
+				const tStringView *IndexFind(size_t Hash, tStringView Text) const;
+			};
+
+			/**
+			 * Convenience typedef for lazy usage of smart_pointers for string pools
+			 */
+			typedef std::shared_ptr<IniStringPool> IniStringPoolPtr;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,260 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniTrace.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Ring buffer of timed spans exportable as Chrome trace events
+ */
+#include "IniTrace.h"
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			// Append a name as JSON string
+			static void JsonNameWrite(std::string &Buffer, const char *Name)
+			{
+				Buffer += '"';
+				for (; '\0' != *Name; ++Name)
+				{
+					if (('"' == *Name) || ('\\' == *Name))
+					{
+						Buffer += '\\';
+					}
+					Buffer += *Name;
+				}
+				Buffer += '"';
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			// Append nanoseconds as microseconds, the unit of the trace event format
+			static void JsonMicrosecondsWrite(std::string &Buffer, uint64_t Nanoseconds)
+			{
+				std::string Fraction = std::to_string(Nanoseconds % 1000);
+				Buffer += std::to_string(Nanoseconds / 1000);
+				Buffer += '.';
+				Buffer.append(3 - Fraction.length(), '0');
+				Buffer += Fraction;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const size_t IniTrace::DefaultCapacity = 4096;
+
+			// ******************************************************************
+			// ******************************************************************
+			const size_t IniTraceEvent::ArgCountMax;
+
+			// ******************************************************************
+			// ******************************************************************
+			IniTrace::IniTrace(size_t Capacity)
+				: m_Mutex()
+				, m_Events((0 == Capacity) ? 1 : Capacity)
+				, m_Next(0)
+				, m_Count(0)
+				, m_Dropped(0)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniTrace::CapacityGet(void) const
+			{
+				return m_Events.size();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniTrace::Clear(void)
+			{
+				std::lock_guard<std::mutex> Lock(m_Mutex);
+				m_Next = 0;
+				m_Count = 0;
+				m_Dropped = 0;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniTrace::ChromeJsonWrite(std::string &Buffer) const
+			{
+				std::vector<IniTraceEvent> Events = EventsGet();
+
+				Buffer += "{\"traceEvents\":[";
+				for (size_t Index = 0; Index < Events.size(); ++Index)
+				{
+					const IniTraceEvent &Event = Events[Index];
+					if (0 != Index)
+					{
+						Buffer += ",";
+					}
+					Buffer += "\n{\"name\":";
+					JsonNameWrite(Buffer, Event.Name);
+					Buffer += ",\"cat\":\"yaip\",\"ph\":\"X\",\"ts\":";
+					JsonMicrosecondsWrite(Buffer, Event.Start);
+					Buffer += ",\"dur\":";
+					JsonMicrosecondsWrite(Buffer, Event.Duration);
+					Buffer += ",\"pid\":1,\"tid\":";
+					Buffer += std::to_string(Event.Thread);
+					if (0 != Event.ArgCount)
+					{
+						Buffer += ",\"args\":{";
+						for (size_t Arg = 0; Arg < Event.ArgCount; ++Arg)
+						{
+							if (0 != Arg)
+							{
+								Buffer += ",";
+							}
+							JsonNameWrite(Buffer, Event.Args[Arg].Name);
+							Buffer += ":";
+							Buffer += std::to_string(Event.Args[Arg].Value);
+						}
+						Buffer += "}";
+					}
+					Buffer += "}";
+				}
+				Buffer += "\n],\"displayTimeUnit\":\"ns\"}\n";
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniTrace::ChromeJsonSave(const std::string &Filename) const
+			{
+				std::string Buffer;
+				ChromeJsonWrite(Buffer);
+
+				std::ofstream TraceFile(Filename, std::ios::out | std::ios::trunc | std::ios::binary);
+				if (!TraceFile.is_open())
+				{
+					return false;
+				}
+				TraceFile.write(Buffer.data(), static_cast<std::streamsize>(Buffer.length()));
+				TraceFile.close();
+
+				return !TraceFile.fail();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			uint64_t IniTrace::DroppedGet(void) const
+			{
+				std::lock_guard<std::mutex> Lock(m_Mutex);
+				return m_Dropped;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			std::vector<IniTraceEvent> IniTrace::EventsGet(void) const
+			{
+				std::lock_guard<std::mutex> Lock(m_Mutex);
+
+				std::vector<IniTraceEvent> Events;
+				Events.reserve(m_Count);
+				size_t Oldest = (m_Next + m_Events.size() - m_Count) % m_Events.size();
+				for (size_t Index = 0; Index < m_Count; ++Index)
+				{
+					Events.push_back(m_Events[(Oldest + Index) % m_Events.size()]);
+				}
+
+				return Events;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			uint64_t IniTrace::NowGet(void)
+			{
+				return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniTrace::Record(const IniTraceEvent &Event)
+			{
+				std::lock_guard<std::mutex> Lock(m_Mutex);
+
+				m_Events[m_Next] = Event;
+				m_Next = (m_Next + 1) % m_Events.size();
+				if (m_Count < m_Events.size())
+				{
+					++m_Count;
+				}
+				else
+				{
+					++m_Dropped;
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniTraceSpan::IniTraceSpan(IniTrace *Trace, const char *Name)
+				: m_Trace(Trace)
+				, m_Event()
+			{
+				if (nullptr != m_Trace)
+				{
+					m_Event.Name = Name;
+					m_Event.Thread = static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+					m_Event.Start = IniTrace::NowGet();
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniTraceSpan::~IniTraceSpan(void)
+			{
+				if (nullptr != m_Trace)
+				{
+					m_Event.Duration = IniTrace::NowGet() - m_Event.Start;
+					m_Trace->Record(m_Event);
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniTraceSpan::ArgAdd(const char *Name, uint64_t Value)
+			{
+				if ((nullptr != m_Trace) && (m_Event.ArgCount < IniTraceEvent::ArgCountMax))
+				{
+					m_Event.Args[m_Event.ArgCount].Name = Name;
+					m_Event.Args[m_Event.ArgCount].Value = Value;
+					++m_Event.ArgCount;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,284 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniTrace.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Ring buffer of timed spans exportable as Chrome trace events
+ */
+#ifndef _INITRACE_H_
+#define _INITRACE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			/**
+			 * Named value attached to a span, shown as argument in the trace viewer
+			 */
+			struct IniTraceArg
+			{
+				/**
+				 * Name of the value, a string literal
+				 */
+				const char *Name;
+
+				/**
+				 * The value
+				 */
+				uint64_t Value;
+			};
+
+			/**
+			 * A finished span
+			 */
+			struct IniTraceEvent
+			{
+				/**
+				 * Maximum number of arguments of a span
+				 */
+				static const size_t ArgCountMax = 4;
+
+				/**
+				 * Name of the span, a string literal
+				 */
+				const char *Name;
+
+				/**
+				 * Start in nanoseconds, see IniTrace::NowGet
+				 */
+				uint64_t Start;
+
+				/**
+				 * Duration in nanoseconds
+				 */
+				uint64_t Duration;
+
+				/**
+				 * Thread which recorded the span
+				 */
+				uint32_t Thread;
+
+				/**
+				 * Number of used arguments
+				 */
+				size_t ArgCount;
+
+				/**
+				 * Arguments of the span
+				 */
+				IniTraceArg Args[ArgCountMax];
+			};
+
+			/**
+			 * Time spent in the steps of parsing, summed over all lines because
+			 * a span per line would flood the ring buffer
+			 */
+			struct IniTraceParseSteps
+			{
+				/**
+				 * Number of parsed lines
+				 */
+				uint64_t Lines = 0;
+
+				/**
+				 * Nanoseconds spent to find the line ends
+				 */
+				uint64_t Split = 0;
+
+				/**
+				 * Nanoseconds spent to classify, trim and copy lines into sections and entries
+				 */
+				uint64_t Match = 0;
+
+				/**
+				 * Nanoseconds spent to add sections and entries to their lists
+				 */
+				uint64_t Add = 0;
+			};
+
+			/**
+			 * Ring buffer of finished spans. When full, the oldest span is overwritten.
+			 * Recording is thread safe, e. g. for spans of parallel parsing.
+			 */
+			class IniTrace
+			{
+			public:
+				/**
+				 * Default number of spans kept
+				 */
+				static const size_t DefaultCapacity;
+
+				/**
+				 * Constructor
+				 * \param Capacity Number of spans kept, at least one
+				 */
+				explicit IniTrace(size_t Capacity);
+
+				/**
+				 * Number of spans kept at most
+				 * \return The capacity
+				 */
+				size_t CapacityGet(void) const;
+
+				/**
+				 * Remove all spans
+				 */
+				void Clear(void);
+
+				/**
+				 * Append all spans in Chrome trace event format, loadable by chrome://tracing or Perfetto
+				 * \param Buffer Buffer to append to
+				 */
+				void ChromeJsonWrite(std::string &Buffer) const;
+
+				/**
+				 * Write all spans in Chrome trace event format to a file
+				 * \param Filename Full qualified filename
+				 * \return true on success otherwise false
+				 */
+				bool ChromeJsonSave(const std::string &Filename) const;
+
+				/**
+				 * Number of spans overwritten because the buffer was full
+				 * \return Number of lost spans
+				 */
+				uint64_t DroppedGet(void) const;
+
+				/**
+				 * Copy of all spans kept, oldest first
+				 * \return The spans
+				 */
+				std::vector<IniTraceEvent> EventsGet(void) const;
+
+				/**
+				 * Current time of a monotonic clock
+				 * \return Nanoseconds since an unspecified start
+				 */
+				static uint64_t NowGet(void);
+
+				/**
+				 * Store a finished span
+				 * \param Event The span
+				 */
+				void Record(const IniTraceEvent &Event);
+
+			private:
+				/**
+				 * Guards all members, spans are recorded by several threads
+				 */
+				mutable std::mutex m_Mutex;
+
+				/**
+				 * Ring buffer of spans
+				 */
+				std::vector<IniTraceEvent> m_Events;
+
+				/**
+				 * Position of the next span to write
+				 */
+				size_t m_Next;
+
+				/**
+				 * Number of valid spans
+				 */
+				size_t m_Count;
+
+				/**
+				 * Number of overwritten spans
+				 */
+				uint64_t m_Dropped;
+			};
+
+			/**
+			 * Convenience typedef for shared pointer
+			 */
+			typedef std::shared_ptr<IniTrace> IniTracePtr;
+
+			/**
+			 * Measures the lifetime of a scope and records it as span. Without a
+			 * trace nothing is measured.
+			 */
+			class IniTraceSpan
+			{
+			public:
+				/**
+				 * Constructor, starts measuring
+				 * \param Trace Trace to record into, nullptr to do nothing
+				 * \param Name Name of the span, a string literal
+				 */
+				IniTraceSpan(IniTrace *Trace, const char *Name);
+
+				/**
+				 * Destructor, records the span
+				 */
+				~IniTraceSpan(void);
+
+				/**
+				 * No copy, a span is recorded once
+				 */
+				IniTraceSpan(const IniTraceSpan &) = delete;
+
+				/**
+				 * No copy, a span is recorded once
+				 */
+				IniTraceSpan &operator=(const IniTraceSpan &) = delete;
+
+				/**
+				 * Attach a value, ignored if all arguments are used
+				 * \param Name Name of the value, a string literal
+				 * \param Value The value
+				 */
+				void ArgAdd(const char *Name, uint64_t Value);
+
+			private:
+				/**
+				 * Trace to record into, nullptr if disabled
+				 */
+				IniTrace *m_Trace;
+
+				/**
+				 * The span, finished by the destructor
+				 */
+				IniTraceEvent m_Event;
+			};
+		}
+	}
+}
+
+#endif
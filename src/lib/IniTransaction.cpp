@@ -0,0 +1,189 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniTransaction.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Batch of sets and deletes applied at once
+ */
+#include "IniTransaction.h"
+#include "YAIP.h"
+#include <set>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			IniTransaction::IniTransaction(YAIP &Parser)
+				: m_Parser(Parser)
+				, m_Sections()
+				, m_SectionIndex()
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniTransaction::~IniTransaction(void)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniTransaction::Commit(void)
+			{
+				// Check everything first, nothing is applied on failure
+				for (auto const &Change : m_Sections)
+				{
+					if (Change.Section.empty())
+					{
+						return false;
+					}
+
+					for (auto const &Key : Change.Keys)
+					{
+						if (Key.Key.empty())
+						{
+							return false;
+						}
+					}
+				}
+
+				for (auto const &Change : m_Sections)
+				{
+					IniSectionPtr Section = m_Parser.m_Sections.ElementFind(Change.Section);
+					std::set<std::string> Kills;
+
+					for (auto const &Key : Change.Keys)
+					{
+						if (Key.Kill)
+						{
+							Kills.insert(Key.Key);
+							continue;
+						}
+
+						if (nullptr == Section)
+						{
+							Section = m_Parser.SectionFindOrAdd(Change.Section);
+						}
+
+						// Existing keys keep their position, only new keys are interned
+						m_Parser.EntrySet(Section, Key.Key, Key.Value);
+					}
+
+					if ((nullptr != Section) && !Kills.empty())
+					{
+						// All keys of the section are removed in one sweep
+						m_Parser.m_Stats.DeleteCount(Section->EntriesDelete(Kills));
+						m_Parser.SectionRemoveIfEmpty(Section);
+					}
+				}
+
+				Discard();
+				return true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniTransaction::Discard(void)
+			{
+				m_Sections.clear();
+				m_SectionIndex.clear();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniTransaction::IsEmpty(void) const
+			{
+				return m_Sections.empty();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniTransaction::SectionKeyKill(const std::string &Section, const std::string &Key)
+			{
+				Record(Section, Key, std::string(), true);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniTransaction::SectionKeyValueSet(const std::string &Section, const std::string &Key, const std::string &Value)
+			{
+				Record(Section, Key, Value, false);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniTransaction::SizeGet(void) const
+			{
+				size_t Size = 0;
+				for (auto const &Change : m_Sections)
+				{
+					Size += Change.Keys.size();
+				}
+				return Size;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniTransaction::Record(const std::string &Section, const std::string &Key, const std::string &Value, bool Kill)
+			{
+				const std::string SectionName = trim(Section);
+				auto SectionIt = m_SectionIndex.find(SectionName);
+				if (m_SectionIndex.end() == SectionIt)
+				{
+					SectionChange Change;
+					Change.Section = SectionName;
+					m_Sections.push_back(Change);
+					SectionIt = m_SectionIndex.insert(std::make_pair(SectionName, m_Sections.size() - 1)).first;
+				}
+				SectionChange &Change = m_Sections[SectionIt->second];
+
+				KeyChange NewKey;
+				NewKey.Key = trim(Key);
+				NewKey.Value = Value;
+				NewKey.Kill = Kill;
+
+				auto KeyIt = Change.KeyIndex.find(NewKey.Key);
+				if (Change.KeyIndex.end() == KeyIt)
+				{
+					Change.KeyIndex.insert(std::make_pair(NewKey.Key, Change.Keys.size()));
+					Change.Keys.push_back(NewKey);
+				}
+				else
+				{
+					Change.Keys[KeyIt->second] = NewKey;
+				}
+			}
+		}
+	}
+}
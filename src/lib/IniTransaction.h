@@ -0,0 +1,197 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniTransaction.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Batch of sets and deletes applied at once
+ */
+#ifndef _INITRANSACTION_H_
+#define _INITRANSACTION_H_
+
+#include "Convert.h"
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			class YAIP;
+
+			/**
+			 * Collects sets and deletes of keys and applies them to a YAIP instance
+			 * on Commit. Changes are grouped by section, each section is looked up
+			 * once and its deleted keys are removed in a single pass. Until Commit
+			 * the YAIP instance is not touched at all, Discard drops all changes.
+			 * \attention Readers of snapshots see a commit completely once YAIP::SnapshotPublish is called
+			 */
+			class IniTransaction
+			{
+			public:
+				/**
+				 * Constructor
+				 * \param Parser Instance to apply the changes to
+				 */
+				explicit IniTransaction(YAIP &Parser);
+
+				/**
+				 * Default destructor, changes not committed are discarded
+				 */
+				virtual ~IniTransaction(void);
+
+				/**
+				 * Apply all changes in the order of their sections and clear the transaction.
+				 * Keys are set like YAIP::SectionKeyValueSet, interning and statistics included.
+				 * \return true on success, false if a section or key name is empty, nothing is applied then
+				 */
+				bool Commit(void);
+
+				/**
+				 * Drop all changes
+				 */
+				void Discard(void);
+
+				/**
+				 * Check if there are no changes
+				 * \return true if empty otherwise false
+				 */
+				bool IsEmpty(void) const;
+
+				/**
+				 * Remember to remove a key, like YAIP::SectionKeyKill empty sections are removed
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 */
+				void SectionKeyKill(const std::string &Section, const std::string &Key);
+
+				/**
+				 * Remember to set a value
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \param Value Specified value to set
+				 */
+				void SectionKeyValueSet(const std::string &Section, const std::string &Key, const std::string &Value);
+
+				/**
+				 * Templated method to remember to set a value
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \param Value Specified value to set
+				 */
+				template<typename VariableType>
+				void SectionKeyValueSet(const std::string &Section, const std::string &Key, const VariableType &Value)
+				{
+					std::string ValueString;
+					Convert::ConvertTo(Value, ValueString);
+					SectionKeyValueSet(Section, Key, ValueString);
+				}
+
+				/**
+				 * Number of changed keys, a key changed twice counts once
+				 * \return Number of changed keys
+				 */
+				size_t SizeGet(void) const;
+
+			private:
+				/**
+				 * Change of a single key
+				 */
+				struct KeyChange
+				{
+					/**
+					 * Trimmed key
+					 */
+					std::string Key;
+
+					/**
+					 * New value, ignored on delete
+					 */
+					std::string Value;
+
+					/**
+					 * true to delete the key, false to set the value
+					 */
+					bool Kill;
+				};
+
+				/**
+				 * Changes of a single section, a later change of a key replaces the earlier one
+				 */
+				struct SectionChange
+				{
+					/**
+					 * Trimmed section name
+					 */
+					std::string Section;
+
+					/**
+					 * Changes in order of their first occurrence
+					 */
+					std::vector<KeyChange> Keys;
+
+					/**
+					 * Key to position in Keys
+					 */
+					std::map<std::string, size_t> KeyIndex;
+				};
+
+				/**
+				 * Instance to apply the changes to
+				 */
+				YAIP &m_Parser;
+
+				/**
+				 * Changes in order of the first occurrence of their section
+				 */
+				std::vector<SectionChange> m_Sections;
+
+				/**
+				 * Section name to position in m_Sections
+				 */
+				std::map<std::string, size_t> m_SectionIndex;
+
+				/**
+				 * Record a change
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \param Value Specified value
+				 * \param Kill true to delete the key
+				 */
+				void Record(const std::string &Section, const std::string &Key, const std::string &Value, bool Kill);
+			};
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,345 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniWatcher.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Watch an INI file and reload it in the background on changes
+ */
+#include "IniWatcher.h"
+#include <chrono>
+
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#else
+#include <ctime>
+#include <sys/types.h>
+#include <sys/stat.h>
+#endif
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			const unsigned int IniWatcher::DefaultDebounce = 100;
+
+			// ******************************************************************
+			// ******************************************************************
+			IniWatcher::IniWatcher(void)
+				: m_Callback()
+				, m_Debounce(DefaultDebounce)
+				, m_Filename()
+				, m_Loader()
+				, m_ReloadCount(0)
+				, m_Thread()
+#ifdef __linux__
+				, m_InotifyFd(-1)
+				, m_WakeFd{ -1, -1 }
+#else
+				, m_Mutex()
+				, m_Stop(false)
+				, m_Wake()
+#endif
+			{
+				// The file is reloaded while others write it, never map it
+				m_Loader.LoadModeSet(IniLoadMode::Stream);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniWatcher::~IniWatcher(void)
+			{
+				Stop();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			unsigned int IniWatcher::DebounceGet(void) const
+			{
+				return m_Debounce;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniWatcher::DebounceSet(unsigned int Milliseconds)
+			{
+				m_Debounce = Milliseconds;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			YAIP &IniWatcher::LoaderGet(void)
+			{
+				return m_Loader;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniWatcher::ReloadCountGet(void) const
+			{
+				return m_ReloadCount;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniWatcher::Running(void) const
+			{
+				return m_Thread.joinable();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniSnapshotPtr IniWatcher::SnapshotGet(void) const
+			{
+				return m_Loader.SnapshotGet();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniWatcher::Start(const std::string &Filename, const tReloadCallback &Callback)
+			{
+				Stop();
+
+				m_Callback = Callback;
+				m_Filename = Filename;
+				m_ReloadCount = 0;
+
+				if (!m_Loader.INIFileLoad(m_Filename))
+				{
+					return false;
+				}
+				m_Loader.SnapshotPublish();
+
+#ifdef __linux__
+				// Watch the directory, editors often replace the file instead of writing it
+				std::string::size_type Slash = m_Filename.find_last_of('/');
+				std::string Directory = (std::string::npos == Slash) ? std::string(".") : m_Filename.substr(0, Slash + 1);
+
+				m_InotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+				if (0 > m_InotifyFd)
+				{
+					return false;
+				}
+
+				if ((0 > inotify_add_watch(m_InotifyFd, Directory.c_str(), IN_CLOSE_WRITE | IN_CREATE | IN_MODIFY | IN_MOVED_TO))
+					|| (0 != pipe2(m_WakeFd, O_CLOEXEC)))
+				{
+					Stop();
+					return false;
+				}
+#else
+				m_Stop = false;
+#endif
+
+				m_Thread = std::thread(&IniWatcher::Watch, this);
+				return true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniWatcher::Stop(void)
+			{
+#ifdef __linux__
+				if (m_Thread.joinable())
+				{
+					char Wake = 0;
+					while ((0 > write(m_WakeFd[1], &Wake, 1)) && (EINTR == errno))
+					{
+					}
+					m_Thread.join();
+				}
+
+				for (int *FileDescriptor : { &m_InotifyFd, &m_WakeFd[0], &m_WakeFd[1] })
+				{
+					if (0 <= *FileDescriptor)
+					{
+						close(*FileDescriptor);
+						*FileDescriptor = -1;
+					}
+				}
+#else
+				if (m_Thread.joinable())
+				{
+					{
+						std::lock_guard<std::mutex> Lock(m_Mutex);
+						m_Stop = true;
+					}
+					m_Wake.notify_all();
+					m_Thread.join();
+				}
+#endif
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniWatcher::Reload(void)
+			{
+				// INIFileLoad clears the loader only, readers keep the published snapshot
+				if (!m_Loader.INIFileLoad(m_Filename))
+				{
+					return false;
+				}
+
+				IniSnapshotPtr Snapshot = m_Loader.SnapshotPublish();
+				++m_ReloadCount;
+				if (m_Callback)
+				{
+					m_Callback(Snapshot);
+				}
+				return true;
+			}
+
+#ifdef __linux__
+			// ******************************************************************
+			// ******************************************************************
+			void IniWatcher::Watch(void)
+			{
+				std::string::size_type Slash = m_Filename.find_last_of('/');
+				const std::string Name = (std::string::npos == Slash) ? m_Filename : m_Filename.substr(Slash + 1);
+
+				// Buffer aligned for struct inotify_event
+				alignas(struct inotify_event) char Buffer[4096];
+				bool Pending = false;
+
+				// Only changes of the file move the deadline, events of other files in the directory do not
+				std::chrono::steady_clock::time_point Deadline;
+
+				for (;;)
+				{
+					int Timeout = -1;
+					if (Pending)
+					{
+						std::chrono::steady_clock::duration Left = Deadline - std::chrono::steady_clock::now();
+						if (Left <= std::chrono::steady_clock::duration::zero())
+						{
+							// No further change within the debounce time
+							Pending = false;
+							Reload();
+							continue;
+						}
+
+						// Round up, poll would return early and spin otherwise
+						Timeout = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(Left).count()) + 1;
+					}
+
+					struct pollfd Wait[2] = { { m_InotifyFd, POLLIN, 0 }, { m_WakeFd[0], POLLIN, 0 } };
+					int Result = poll(Wait, 2, Timeout);
+					if (0 > Result)
+					{
+						if (EINTR == errno)
+						{
+							continue;
+						}
+						break;
+					}
+
+					if (0 != Wait[1].revents)
+					{
+						break;
+					}
+
+					ssize_t Length;
+					while (0 < (Length = read(m_InotifyFd, Buffer, sizeof(Buffer))))
+					{
+						for (char *Current = Buffer; Current < Buffer + Length;)
+						{
+							const struct inotify_event *Event = reinterpret_cast<const struct inotify_event *>(Current);
+
+							// Lost events may have been changes of the file
+							if ((0 != (Event->mask & IN_Q_OVERFLOW)) || ((0 < Event->len) && (Name == Event->name)))
+							{
+								Pending = true;
+								Deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_Debounce);
+							}
+							Current += sizeof(struct inotify_event) + Event->len;
+						}
+					}
+				}
+			}
+#else
+			// ******************************************************************
+			// ******************************************************************
+			// Size and modification time of a file, -1 and 0 if it does not exist
+			static void StampGet(const std::string &Filename, long long &Size, time_t &Time)
+			{
+#ifdef _WIN32
+				struct _stat tmpbuffer;
+				int result = _stat(Filename.c_str(), &tmpbuffer);
+#else
+				struct stat tmpbuffer;
+				int result = stat(Filename.c_str(), &tmpbuffer);
+#endif
+				Size = (0 == result) ? static_cast<long long>(tmpbuffer.st_size) : -1;
+				Time = (0 == result) ? tmpbuffer.st_mtime : 0;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniWatcher::Watch(void)
+			{
+				long long Size;
+				time_t Time;
+				StampGet(m_Filename, Size, Time);
+				bool Pending = false;
+
+				std::unique_lock<std::mutex> Lock(m_Mutex);
+				while (!m_Wake.wait_for(Lock, std::chrono::milliseconds(m_Debounce), [this] { return m_Stop; }))
+				{
+					long long CurrentSize;
+					time_t CurrentTime;
+					StampGet(m_Filename, CurrentSize, CurrentTime);
+
+					if ((CurrentSize != Size) || (CurrentTime != Time))
+					{
+						Size = CurrentSize;
+						Time = CurrentTime;
+						Pending = true;
+					}
+					else if (Pending)
+					{
+						// No further change within the debounce time
+						Pending = false;
+						Lock.unlock();
+						Reload();
+						Lock.lock();
+					}
+				}
+			}
+#endif
+		}
+	}
+}
@@ -0,0 +1,224 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniWatcher.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Watch an INI file and reload it in the background on changes
+ */
+#ifndef _INIWATCHER_H_
+#define _INIWATCHER_H_
+
+#include "IniSnapshot.h"
+#include "YAIP.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			/**
+			 * Watches a loaded INI file and reloads it on changes. The file is parsed on
+			 * a background thread into a private YAIP instance and published as a new
+			 * IniSnapshot, readers never see a partially loaded configuration.
+			 * Bursts of writes are combined, the file is reloaded once it has not been
+			 * changed for the debounce time. On Linux changes are reported by inotify,
+			 * on other platforms size and modification time are polled.
+			 */
+			class IniWatcher
+			{
+			public:
+				/**
+				 * Convenience typedef for the callback invoked after a reload
+				 */
+				typedef std::function<void(const IniSnapshotPtr &)> tReloadCallback;
+
+				/**
+				 * Default debounce time in milliseconds
+				 */
+				static const unsigned int DefaultDebounce;
+
+				/**
+				 * Default constructor
+				 */
+				IniWatcher(void);
+
+				/**
+				 * Default destructor, stops watching
+				 */
+				virtual ~IniWatcher(void);
+
+				/**
+				 * No copy, the background thread refers to this instance
+				 */
+				IniWatcher(const IniWatcher &) = delete;
+
+				/**
+				 * No copy, the background thread refers to this instance
+				 */
+				IniWatcher &operator=(const IniWatcher &) = delete;
+
+				/**
+				 * Get the time a file has to stay unchanged before it is reloaded
+				 * \return Debounce time in milliseconds
+				 */
+				unsigned int DebounceGet(void) const;
+
+				/**
+				 * Set the time a file has to stay unchanged before it is reloaded
+				 * \param Milliseconds Debounce time in milliseconds
+				 * \attention Only effective for the next Start
+				 */
+				void DebounceSet(unsigned int Milliseconds);
+
+				/**
+				 * Get the instance used to load the file, e. g. to set load, parse or
+				 * thread options or to enable the binary cache. It reads the file with
+				 * IniLoadMode::Stream, a file truncated by a writer while it is mapped
+				 * would raise SIGBUS in the background thread.
+				 * \return The loading instance
+				 * \attention Must not be used while the watcher is running
+				 */
+				YAIP &LoaderGet(void);
+
+				/**
+				 * Number of reloads since Start
+				 * \return Number of published reloads
+				 */
+				size_t ReloadCountGet(void) const;
+
+				/**
+				 * Check if the file is watched
+				 * \return true if running otherwise false
+				 */
+				bool Running(void) const;
+
+				/**
+				 * Get the configuration loaded last. Safe to call from any thread at any time.
+				 * \return The snapshot loaded last, nullptr before Start
+				 */
+				IniSnapshotPtr SnapshotGet(void) const;
+
+				/**
+				 * Load the file and start watching it. The initial load is done by the
+				 * calling thread, reloads are done by a background thread which calls
+				 * Callback after the new snapshot is published.
+				 * \param Filename Full qualified filename of the INI file
+				 * \param Callback Called on the background thread after each reload, may be empty
+				 * \return true on success, false if the file cannot be loaded or watched
+				 */
+				bool Start(const std::string &Filename, const tReloadCallback &Callback);
+
+				/**
+				 * Stop watching and wait for the background thread. The snapshot loaded
+				 * last remains available.
+				 */
+				void Stop(void);
+
+			private:
+				/**
+				 * Called after each reload
+				 */
+				tReloadCallback m_Callback;
+
+				/**
+				 * Debounce time in milliseconds
+				 */
+				unsigned int m_Debounce;
+
+				/**
+				 * Full qualified filename of the INI file
+				 */
+				std::string m_Filename;
+
+				/**
+				 * Loads the file and publishes the snapshots
+				 */
+				YAIP m_Loader;
+
+				/**
+				 * Number of reloads since Start
+				 */
+				std::atomic<size_t> m_ReloadCount;
+
+				/**
+				 * Background thread waiting for changes
+				 */
+				std::thread m_Thread;
+
+#ifdef __linux__
+				/**
+				 * inotify instance watching the directory of the file
+				 */
+				int m_InotifyFd;
+
+				/**
+				 * Pipe to wake up the background thread on Stop
+				 */
+				int m_WakeFd[2];
+#else
+				/**
+				 * Protects m_Stop
+				 */
+				std::mutex m_Mutex;
+
+				/**
+				 * Flag to end the background thread
+				 */
+				bool m_Stop;
+
+				/**
+				 * Wakes up the background thread on Stop
+				 */
+				std::condition_variable m_Wake;
+#endif
+
+				/**
+				 * Load the file and publish it, the old snapshot is kept on failure
+				 * \return true on success otherwise false
+				 */
+				bool Reload(void);
+
+				/**
+				 * Background thread waiting for changes
+				 */
+				void Watch(void);
+			};
+		}
+	}
+}
+
+#endif
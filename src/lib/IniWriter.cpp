@@ -0,0 +1,157 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniWriter.cpp
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Buffered writer used to serialize sections and entries
+ */
+#include "IniWriter.h"
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			// ******************************************************************
+			// ******************************************************************
+			const size_t IniWriter::DefaultChunkSize = 64 * 1024;
+
+			// ******************************************************************
+			// ******************************************************************
+			IniWriter::IniWriter(void)
+				: m_BufferOwn()
+				, m_Buffer(m_BufferOwn)
+				, m_Stream(nullptr)
+				, m_BufferStart(0)
+				, m_Written(0)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniWriter::IniWriter(std::string &Buffer)
+				: m_BufferOwn()
+				, m_Buffer(Buffer)
+				, m_Stream(nullptr)
+				, m_BufferStart(Buffer.size())
+				, m_Written(0)
+			{
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniWriter::IniWriter(std::ostream &Stream)
+				: m_BufferOwn()
+				, m_Buffer(m_BufferOwn)
+				, m_Stream(&Stream)
+				, m_BufferStart(0)
+				, m_Written(0)
+			{
+				// Some room for the line exceeding the chunk size
+				m_Buffer.reserve(DefaultChunkSize + DefaultChunkSize / 4);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniWriter::~IniWriter(void)
+			{
+				Flush();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniWriter::Append(char Character)
+			{
+				m_Buffer.push_back(Character);
+				FlushIfFull();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniWriter::Append(const char *Data, size_t Length)
+			{
+				m_Buffer.append(Data, Length);
+				FlushIfFull();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniWriter::Append(const std::string &Data)
+			{
+				m_Buffer.append(Data);
+				FlushIfFull();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const std::string &IniWriter::BufferGet(void) const
+			{
+				return m_Buffer;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool IniWriter::Flush(void)
+			{
+				if (nullptr == m_Stream)
+				{
+					return true;
+				}
+
+				if (!m_Buffer.empty())
+				{
+					m_Stream->write(m_Buffer.data(), static_cast<std::streamsize>(m_Buffer.size()));
+					m_Written += m_Buffer.size();
+					m_Buffer.clear();
+				}
+
+				return m_Stream->good();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			size_t IniWriter::SizeGet(void) const
+			{
+				return m_Written + m_Buffer.size() - m_BufferStart;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void IniWriter::FlushIfFull(void)
+			{
+				if ((nullptr != m_Stream) && (DefaultChunkSize <= m_Buffer.size()))
+				{
+					Flush();
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,181 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+/**
+ * \file	IniWriter.h
+ * \author	ThirtySomething
+ * \date	2016-09-19
+ * \brief	Buffered writer used to serialize sections and entries
+ */
+#ifndef _INIWRITER_H_
+#define _INIWRITER_H_
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+ /**
+  * Namespace of YAIP
+  */
+namespace net
+{
+	/**
+	 * Namespace of YAIP
+	 */
+	namespace derpaul
+	{
+		/**
+		 * Namespace of YAIP
+		 */
+		namespace yaip
+		{
+			/**
+			 * Method used to write an INI file
+			 */
+			enum class IniSaveMode
+			{
+				/**
+				 * Always write the whole file
+				 */
+				Full,
+
+				/**
+				 * Keep the parts of the file written last which are unchanged, see YAIP::INIFileSave
+				 */
+				Incremental
+			};
+
+			/**
+			 * Appends serialized sections and entries to a single growable buffer.
+			 * Without a stream the buffer keeps everything, with a stream the buffer
+			 * is written out in large chunks and reused.
+			 */
+			class IniWriter
+			{
+			public:
+				/**
+				 * Size of the buffer which triggers writing to the stream
+				 */
+				static const size_t DefaultChunkSize;
+
+				/**
+				 * Constructor, collect everything in an own buffer
+				 */
+				IniWriter(void);
+
+				/**
+				 * Constructor, append everything to a buffer of the caller
+				 * \param Buffer Buffer to append to, has to outlive the writer
+				 */
+				explicit IniWriter(std::string &Buffer);
+
+				/**
+				 * Constructor, write to a stream in chunks
+				 * \param Stream Stream to write to, has to outlive the writer
+				 */
+				explicit IniWriter(std::ostream &Stream);
+
+				/**
+				 * Default destructor, writes remaining data to the stream
+				 */
+				virtual ~IniWriter(void);
+
+				/**
+				 * No copy, the buffer may belong to the caller
+				 */
+				IniWriter(const IniWriter &) = delete;
+
+				/**
+				 * No copy, the buffer may belong to the caller
+				 */
+				IniWriter &operator=(const IniWriter &) = delete;
+
+				/**
+				 * Append a single character
+				 * \param Character Character to append
+				 */
+				void Append(char Character);
+
+				/**
+				 * Append a range of characters
+				 * \param Data Start of range
+				 * \param Length Length of range
+				 */
+				void Append(const char *Data, size_t Length);
+
+				/**
+				 * Append a string
+				 * \param Data String to append
+				 */
+				void Append(const std::string &Data);
+
+				/**
+				 * Get content not yet written to a stream
+				 * \return The buffer
+				 */
+				const std::string &BufferGet(void) const;
+
+				/**
+				 * Write the buffer to the stream and empty it, nothing happens without a stream
+				 * \return true on success or without a stream, false if the stream failed
+				 */
+				bool Flush(void);
+
+				/**
+				 * Number of bytes appended by this writer, written or not
+				 * \return Size in bytes
+				 */
+				size_t SizeGet(void) const;
+
+			private:
+				/**
+				 * Own buffer, unused if the caller supplied one
+				 */
+				std::string m_BufferOwn;
+
+				/**
+				 * Buffer in use
+				 */
+				std::string &m_Buffer;
+
+				/**
+				 * Stream to write to, nullptr to collect everything
+				 */
+				std::ostream *m_Stream;
+
+				/**
+				 * Size of the buffer before the first append
+				 */
+				size_t m_BufferStart;
+
+				/**
+				 * Number of bytes written to the stream
+				 */
+				size_t m_Written;
+
+				/**
+				 * Write the buffer to the stream if it is full
+				 */
+				void FlushIfFull(void);
+			};
+		}
+	}
+}
+
+#endif
@@ -26,11 +26,17 @@
 #ifndef _TINIELEMENTLIST_H_
 #define _TINIELEMENTLIST_H_
 
+#include "IniMemoryResource.h"
+#include "IniString.h"
+#include "IniStringPool.h"
+#include "IniWriter.h"
 #include "string_extensions.h"
 #include <algorithm>
+#include <cstring>
 #include <list>
+#include <set>
 #include <string>
-#include <sstream>
+#include <unordered_map>
 #include <vector>
 
  /**
@@ -60,10 +66,36 @@ namespace net
 			{
 			public:
 				/**
-				 * Default constructor
+				 * Vector of elements, allocated from the resource of the list
+				 */
+				typedef std::vector<TIniElement, IniAllocator<TIniElement>> tElements;
+
+				/**
+				 * Hash index of elements, allocated from the resource of the list
+				 */
+				typedef std::unordered_multimap<size_t, TIniElement, std::hash<size_t>, std::equal_to<size_t>, IniAllocator<std::pair<const size_t, TIniElement>>> tIndex;
+
+				/**
+				 * Iterator over the elements, in order of insertion or after sort
+				 */
+				typedef typename tElements::const_iterator const_iterator;
+
+				/**
+				 * Default constructor, uses the global heap
 				 */
 				TIniElementList(void)
-					: m_Elements()
+					: TIniElementList(nullptr)
+				{
+				}
+
+				/**
+				 * Constructor
+				 * \param Resource Resource for the vector and the index, nullptr for the global heap
+				 */
+				explicit TIniElementList(const IniMemoryResourcePtr &Resource)
+					: m_Elements(IniAllocator<TIniElement>(Resource))
+					, m_Index(0, std::hash<size_t>(), std::equal_to<size_t>(), IniAllocator<std::pair<const size_t, TIniElement>>(Resource))
+					, m_IndexEnabled(true)
 				{
 				}
 
@@ -75,12 +107,22 @@ namespace net
 					clear();
 				}
 
+				/**
+				 * Start of the elements
+				 * \return Iterator to the first element
+				 */
+				const_iterator begin(void) const
+				{
+					return m_Elements.begin();
+				}
+
 				/**
 				 * Clear the list
 				 */
 				void clear(void)
 				{
 					m_Elements.clear();
+					m_Index.clear();
 				}
 
 				/**
@@ -90,6 +132,17 @@ namespace net
 				void ElementAdd(const TIniElement &Element)
 				{
 					m_Elements.push_back(Element);
+
+					// Like the linear search the index returns the first element of an identifier
+					if (m_IndexEnabled)
+					{
+						const IniString &Identifier = Element->ElementIdentifierGet();
+						size_t Hash = strhash(Identifier.data(), Identifier.length());
+						if (nullptr == IndexFind(Hash, Identifier.view(), nullptr, nullptr))
+						{
+							m_Index.insert(std::make_pair(Hash, Element));
+						}
+					}
 				}
 
 				/**
@@ -98,30 +151,177 @@ namespace net
 				 */
 				void ElementDelete(const TIniElement &Element)
 				{
+					ElementDelete(Element, [](const TIniElement &) {});
+				}
+
+				/**
+				 * Remove given element from list
+				 * \param Element Element to delete
+				 * \param Removed Called for each removed element
+				 */
+				template <typename TRemoved> void ElementDelete(const TIniElement &Element, TRemoved Removed)
+				{
+					// Keep element alive, the reference may point into m_Elements
+					TIniElement ElementKeep = Element;
+					const IniString &Identifier = ElementKeep->ElementIdentifierGet();
+
+					if (m_IndexEnabled)
+					{
+						auto Range = m_Index.equal_range(strhash(Identifier.data(), Identifier.length()));
+						for (auto it = Range.first; it != Range.second; ++it)
+						{
+							if (it->second->ElementIdentifierGet() == Identifier)
+							{
+								m_Index.erase(it);
+								break;
+							}
+						}
+					}
+
 					m_Elements.erase(
 						std::remove_if(
 							m_Elements.begin(),
 							m_Elements.end(),
-							[&Element](const TIniElement &obj) { return obj->ElementIdentifierGet() == Element->ElementIdentifierGet(); }
+							[&Identifier, &Removed](const TIniElement &obj)
+							{
+								if (obj->ElementIdentifierGet() != Identifier)
+								{
+									return false;
+								}
+								Removed(obj);
+								return true;
+							}
 						),
 						m_Elements.end()
 					);
 				}
 
+				/**
+				 * Remove all elements of the given identifiers in a single pass
+				 * \param Identifiers Trimmed identifiers of the elements to delete
+				 * \return Number of deleted elements
+				 */
+				size_t ElementsDelete(const std::set<std::string> &Identifiers)
+				{
+					return ElementsDelete(Identifiers, [](const TIniElement &) {});
+				}
+
+				/**
+				 * Remove all elements of the given identifiers in a single pass
+				 * \param Identifiers Trimmed identifiers of the elements to delete
+				 * \param Removed Called for each removed element
+				 * \return Number of deleted elements
+				 */
+				template <typename TRemoved> size_t ElementsDelete(const std::set<std::string> &Identifiers, TRemoved Removed)
+				{
+					// Hash the identifiers once, elements are compared by view without creating strings
+					typedef std::pair<size_t, tStringView> tHashedIdentifier;
+					std::vector<tHashedIdentifier> Hashed;
+					Hashed.reserve(Identifiers.size());
+					for (auto const &Identifier : Identifiers)
+					{
+						Hashed.push_back(std::make_pair(strhash(Identifier.data(), Identifier.length()), tStringView(Identifier.data(), Identifier.length())));
+					}
+					auto HashLess = [](const tHashedIdentifier &Left, const tHashedIdentifier &Right) { return Left.first < Right.first; };
+					std::sort(Hashed.begin(), Hashed.end(), HashLess);
+
+					size_t Count = m_Elements.size();
+					m_Elements.erase(
+						std::remove_if(
+							m_Elements.begin(),
+							m_Elements.end(),
+							[&Hashed, &HashLess, &Removed](const TIniElement &obj)
+							{
+								tStringView Identifier = obj->ElementIdentifierGet().view();
+								auto Range = std::equal_range(Hashed.begin(), Hashed.end(), tHashedIdentifier(strhash(Identifier.data(), Identifier.length()), tStringView()), HashLess);
+								auto Match = std::find_if(Range.first, Range.second, [&Identifier](const tHashedIdentifier &Candidate) { return Candidate.second == Identifier; });
+								if (Range.second == Match)
+								{
+									return false;
+								}
+								Removed(obj);
+								return true;
+							}
+						),
+						m_Elements.end()
+					);
+					Count -= m_Elements.size();
+
+					if (m_IndexEnabled && (0 < Count))
+					{
+						for (auto const &Identifier : Hashed)
+						{
+							auto Range = m_Index.equal_range(Identifier.first);
+							for (auto it = Range.first; it != Range.second; ++it)
+							{
+								if (it->second->ElementIdentifierGet().view() == Identifier.second)
+								{
+									m_Index.erase(it);
+									break;
+								}
+							}
+						}
+					}
+
+					return Count;
+				}
+
+				/**
+				 * End of the elements
+				 * \return Iterator behind the last element
+				 */
+				const_iterator end(void) const
+				{
+					return m_Elements.end();
+				}
+
 				/**
 				 * Find element by identifier
 				 * \param ElementName Name to identify element
 				 * \return Pointer to element if exists otherwise nullptr
 				 */
-				TIniElement ElementFind(const std::string &ElementName)
+				TIniElement ElementFind(tStringView ElementName) const
+				{
+					const TIniElement *Element = ElementLookup(ElementName);
+					return (nullptr == Element) ? nullptr : *Element;
+				}
+
+				/**
+				 * Find element by identifier without touching its reference count
+				 * \param ElementName Name to identify element
+				 * \return Pointer to the stored element if exists otherwise nullptr, valid until the list is modified
+				 */
+				const TIniElement *ElementLookup(tStringView ElementName) const
 				{
-					std::string ElementNameWork = trim(ElementName);
-					TIniElement Element = nullptr;
+					return ElementLookup(ElementName, nullptr);
+				}
 
-					auto it = std::find_if(m_Elements.begin(), m_Elements.end(), [&ElementNameWork](const TIniElement &obj) {return obj->ElementIdentifierGet() == ElementNameWork; });
+				/**
+				 * Find element by identifier without touching its reference count. The name
+				 * is looked up once in the pool, identifiers interned by the pool are then
+				 * compared by their ID instead of their characters.
+				 * \param ElementName Name to identify element
+				 * \param Pool Pool the identifiers may be interned by, nullptr to compare all characters
+				 * \return Pointer to the stored element if exists otherwise nullptr, valid until the list is modified
+				 */
+				const TIniElement *ElementLookup(tStringView ElementName, const IniStringPool *Pool) const
+				{
+					// Trim the view instead of creating a trimmed copy
+					tStringView Name = trimview(ElementName);
+					size_t Hash = strhash(Name.data(), Name.length());
+					const char *Id = (nullptr != Pool) ? Pool->IdFind(Hash, Name) : nullptr;
+
+					if (m_IndexEnabled)
+					{
+						return IndexFind(Hash, Name, Pool, Id);
+					}
+
+					const TIniElement *Element = nullptr;
+
+					auto it = std::find_if(m_Elements.begin(), m_Elements.end(), [&Name, Pool, Id](const TIniElement &obj) { return IdentifierEqual(obj, Name, Pool, Id); });
 					if (it != m_Elements.end())
 					{
-						Element = *it;
+						Element = &(*it);
 					}
 
 					return Element;
@@ -137,12 +337,80 @@ namespace net
 
 					for (auto CurrentElementPtr = m_Elements.begin(); CurrentElementPtr != m_Elements.end(); ++CurrentElementPtr)
 					{
-						List.push_back((*CurrentElementPtr)->ElementIdentifierGet());
+						List.push_back((*CurrentElementPtr)->ElementIdentifierGet().str());
 					}
 
 					return List;
 				}
 
+				/**
+				 * Enable or disable the hash index used by ElementFind.
+				 * Enabling builds the index from the current elements.
+				 * \param Enable true to use the index, false for linear search
+				 */
+				void IndexEnable(bool Enable)
+				{
+					m_IndexEnabled = Enable;
+					IndexRebuild();
+				}
+
+				/**
+				 * Check if the hash index is used by ElementFind
+				 * \return true if enabled otherwise false
+				 */
+				bool IndexEnabled(void) const
+				{
+					return m_IndexEnabled;
+				}
+
+				/**
+				 * Build the hash index from scratch
+				 * \attention Required after changing the identifier of an element which is already part of the list
+				 */
+				void IndexRebuild(void)
+				{
+					m_Index.clear();
+					if (m_IndexEnabled)
+					{
+						// An empty list allocates no buckets, e. g. in a new arena
+						if (!m_Elements.empty())
+						{
+							m_Index.reserve(m_Elements.size());
+						}
+						for (auto const &Element : m_Elements)
+						{
+							const IniString &Identifier = Element->ElementIdentifierGet();
+							size_t Hash = strhash(Identifier.data(), Identifier.length());
+							if (nullptr == IndexFind(Hash, Identifier.view(), nullptr, nullptr))
+							{
+								m_Index.insert(std::make_pair(Hash, Element));
+							}
+						}
+					}
+				}
+
+				/**
+				 * Get the resource of the vector and the index
+				 * \return The resource
+				 */
+				IniMemoryResourcePtr ResourceGet(void) const
+				{
+					return m_Elements.get_allocator().ResourceGet();
+				}
+
+				/**
+				 * Move the vector and the index to another resource, the elements itself stay where they are
+				 * \param Resource New resource, nullptr for the global heap
+				 */
+				void ResourceSet(const IniMemoryResourcePtr &Resource)
+				{
+					tElements Elements(m_Elements.begin(), m_Elements.end(), IniAllocator<TIniElement>(Resource));
+					tIndex Index(0, std::hash<size_t>(), std::equal_to<size_t>(), IniAllocator<std::pair<const size_t, TIniElement>>(Resource));
+					m_Elements.swap(Elements);
+					m_Index.swap(Index);
+					IndexRebuild();
+				}
+
 				/**
 				 * Determine size of list
 				 * \return Size of list
@@ -158,14 +426,23 @@ namespace net
 				 */
 				std::string to_string(void) const
 				{
-					std::ostringstream tmpStream;
+					std::string Result;
+					IniWriter Writer(Result);
+					Write(Writer);
 
-					for (auto CurrentElementPtr = m_Elements.begin(); CurrentElementPtr != m_Elements.end(); ++CurrentElementPtr)
+					return Result;
+				}
+
+				/**
+				 * Append the string representation of all elements to a writer
+				 * \param Writer Writer to append to
+				 */
+				void Write(IniWriter &Writer) const
+				{
+					for (auto const &Element : m_Elements)
 					{
-						tmpStream << (*CurrentElementPtr)->to_string();
+						Element->Write(Writer);
 					}
-
-					return tmpStream.str();
 				}
 
 				/**
@@ -177,7 +454,59 @@ namespace net
 				/**
 				 * Vector of elements
 				 */
-				std::vector<TIniElement> m_Elements;
+				tElements m_Elements;
+
+				/**
+				 * Hash of identifier to first element with this identifier
+				 */
+				tIndex m_Index;
+
+				/**
+				 * Flag if m_Index is maintained and used
+				 */
+				bool m_IndexEnabled;
+
+				/**
+				 * Compare identifier of an element with a name without allocation
+				 * \param Element Element to compare
+				 * \param Name Trimmed name
+				 * \param Pool Pool the identifier may be interned by, nullptr to compare all characters
+				 * \param Id ID of the name in the pool, nullptr if the name is not interned
+				 * \return true on equal identifiers, otherwise false
+				 */
+				static bool IdentifierEqual(const TIniElement &Element, tStringView Name, const IniStringPool *Pool, const char *Id)
+				{
+					// A pool holds each string once, interned identifiers are equal by ID only
+					const IniString &Identifier = Element->ElementIdentifierGet();
+					if ((nullptr != Pool) && Identifier.IsSharedBy(Pool))
+					{
+						return Identifier.data() == Id;
+					}
+
+					return (Identifier.length() == Name.length()) && (0 == memcmp(Identifier.data(), Name.data(), Name.length()));
+				}
+
+				/**
+				 * Find element by identifier using the hash index
+				 * \param Hash Hash of the name, see strhash
+				 * \param Name Trimmed name
+				 * \param Pool Pool the identifiers may be interned by, nullptr to compare all characters
+				 * \param Id ID of the name in the pool, nullptr if the name is not interned
+				 * \return Pointer to the indexed element if exists otherwise nullptr
+				 */
+				const TIniElement *IndexFind(size_t Hash, tStringView Name, const IniStringPool *Pool, const char *Id) const
+				{
+					auto Range = m_Index.equal_range(Hash);
+					for (auto it = Range.first; it != Range.second; ++it)
+					{
+						if (IdentifierEqual(it->second, Name, Pool, Id))
+						{
+							return &(it->second);
+						}
+					}
+
+					return nullptr;
+				}
 			};
 		}
 	}
@@ -24,10 +24,20 @@
  * \brief	Implementation of Yet Another INI Parser
  */
 #include "YAIP.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <fstream>
+#include <future>
 #include <sstream>
+#include <thread>
 
-#ifndef _WIN32
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#else
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -48,10 +58,31 @@ namespace net
 		 */
 		namespace yaip
 		{
+			// ******************************************************************
+			// ******************************************************************
+			// Minimum size of a part parsed by its own thread
+			static const size_t ParallelPartSize = 64 * 1024;
+
 			// ******************************************************************
 			// ******************************************************************
 			YAIP::YAIP()
 				: m_Sections()
+				, m_Resource()
+				, m_ArenaEnabled(false)
+				, m_Pool()
+				, m_CacheEnabled(false)
+				, m_SchemaBindings()
+				, m_LoadMode(IniLoadMode::Mapped)
+				, m_ParseMode(IniParseMode::Scanner)
+				, m_SaveMode(IniSaveMode::Full)
+				, m_SavedFile()
+				, m_SavedSize(0)
+				, m_SavedTime(0)
+				, m_Snapshot()
+				, m_Stats()
+				, m_ThreadCount(1)
+				, m_Trace()
+				, m_ValueCacheEnabled(false)
 			{
 			}
 
@@ -59,14 +90,62 @@ namespace net
 			// ******************************************************************
 			YAIP::~YAIP(void)
 			{
-				Clear();
+				// Not Clear, it would create a new arena or pool only to release it
+				m_Sections.clear();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::ArenaEnable(bool Enable)
+			{
+				m_ArenaEnabled = Enable;
+				ResourceApply(Enable ? std::make_shared<IniArena>(IniArena::DefaultBlockSize) : nullptr);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool YAIP::ArenaEnabled(void) const
+			{
+				return m_ArenaEnabled;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::CacheEnable(bool Enable)
+			{
+				m_CacheEnabled = Enable;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool YAIP::CacheEnabled(void) const
+			{
+				return m_CacheEnabled;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
 			void YAIP::Clear(void)
 			{
+				// Entries may still be referenced elsewhere, their handles expire anyway
+				for (auto const &Section : m_Sections)
+				{
+					Section->HandlesDetach();
+				}
 				m_Sections.clear();
+				m_SavedFile.clear();
+
+				// Elements still referenced outside keep the old arena alive,
+				// otherwise all its blocks are released right here. An unused
+				// arena or pool is kept.
+				if (m_ArenaEnabled && (0 != static_cast<IniArena *>(m_Resource.get())->BlockCount()))
+				{
+					ArenaEnable(true);
+				}
+				else if ((nullptr != m_Pool) && (0 != m_Pool->SizeGet()))
+				{
+					InternEnable(true);
+				}
 			}
 
 			// ******************************************************************
@@ -95,44 +174,162 @@ namespace net
 			// ******************************************************************
 			bool YAIP::INIFileLoad(const std::string &Filename)
 			{
+				IniStatsTimer Timer(m_Stats, IniStatsPhase::Load);
+				IniTraceSpan Span(m_Trace.get(), "INIFileLoad");
 				bool Success = false;
-				std::ifstream IniFile;
 
 				// Always clear internal storage
-				Clear();
+				{
+					IniTraceSpan ClearSpan(m_Trace.get(), "Clear");
+					Clear();
+				}
+
+				// The image holds neither interned strings nor the result of the regular expressions
+				if (m_CacheEnabled && (nullptr == m_Pool) && (IniParseMode::Scanner == m_ParseMode))
+				{
+					Success = INIFileLoadCached(Filename);
+				}
+				else if (IniLoadMode::Mapped == m_LoadMode)
+				{
+					// Parse straight out of the mapped file, no line copies
+					IniFileBuffer FileBuffer;
+					bool Opened = false;
+					{
+						IniTraceSpan ReadSpan(m_Trace.get(), "FileRead");
+						Opened = FileBuffer.Open(Filename);
+					}
+					if (Opened)
+					{
+						ParseFileContent(FileBuffer.Data(), FileBuffer.Size());
+						Success = true;
+					}
+				}
+				else
+				{
+					// Open the INI file for reading
+					std::ifstream IniFile;
+					IniFile.open(Filename, std::ios::in);
 
-				// Open the INI file for reading
-				IniFile.open(Filename, std::ios::in);
+					/**
+					 * \todo Handle file errors like file does not exist
+					 */
+					if (IniFile.is_open())
+					{
+						std::string CurrentLine;
 
-				/**
-				 * \todo Handle file errors like file does not exist
-				 */
-				if (IniFile.is_open())
+						// Temporary storage for all lines of the INI file
+						tListString FileContent;
+
+						// Read as long as lines exist
+						{
+							IniTraceSpan ReadSpan(m_Trace.get(), "FileRead");
+							while (std::getline(IniFile, CurrentLine))
+							{
+								FileContent.push_back(CurrentLine);
+							}
+							IniFile.close();
+						}
+
+						// Parse INI file
+						ParseFileContent(FileContent);
+						Success = true;
+					}
+				}
+
+				if (Success && !m_SchemaBindings.empty())
+				{
+					IniTraceSpan BindSpan(m_Trace.get(), "SchemaBind");
+					for (auto const &Binding : m_SchemaBindings)
+					{
+						Binding(*this);
+					}
+				}
+
+				return Success;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool YAIP::INIFileLoadCached(const std::string &Filename)
+			{
+				IniCacheKey Key = { 0, 0, 0 };
+				size_t FileSize = 0;
+				if (!FileStampGet(Filename, FileSize, Key.Time))
 				{
-					std::string CurrentLine;
+					return false;
+				}
+				Key.Size = static_cast<uint64_t>(FileSize);
 
-					// Temporary storage for all lines of the INI file
-					tListString FileContent;
+				// Size and time in nanoseconds identify an unchanged file without reading it.
+				// Only if the time differs, e. g. after a copy or touch, the content is hashed.
+				const std::string CacheFile = IniCache::FilenameGet(Filename);
+				IniFileBuffer FileBuffer;
+				bool SourceRead = false;
+				bool Loaded = false;
+				bool StampEqual = false;
+				{
+					IniTraceSpan CacheSpan(m_Trace.get(), "CacheLoad");
+					std::vector<IniSectionPtr> Sections;
+					IniCache Cache;
+					if (Cache.Open(CacheFile) && (Cache.KeyGet().Size == Key.Size))
+					{
+						StampEqual = (Cache.KeyGet().Time == Key.Time);
+						if (StampEqual)
+						{
+							Key.Hash = Cache.KeyGet().Hash;
+						}
+						else
+						{
+							SourceRead = FileBuffer.Open(Filename);
+							Key.Hash = SourceRead ? static_cast<uint64_t>(strhash(FileBuffer.Data(), FileBuffer.Size())) : 0;
+						}
+						Loaded = (StampEqual || SourceRead) && (Cache.KeyGet().Hash == Key.Hash) && Cache.Load(m_Resource, Sections);
+					}
 
-					// Read as long as lines exist
-					while (std::getline(IniFile, CurrentLine))
+					for (auto const &Section : Sections)
 					{
-						FileContent.push_back(CurrentLine);
+						m_Sections.ElementAdd(Section);
 					}
-					IniFile.close();
+				}
 
-					// Parse INI file
-					ParseFileContent(FileContent);
-					Success = true;
+				// Remember the new time of an unchanged content
+				if (Loaded && !StampEqual)
+				{
+					IniTraceSpan CacheSpan(m_Trace.get(), "CacheSave");
+					IniCache::Save(CacheFile, Key, m_Sections);
+				}
+				if (Loaded)
+				{
+					return true;
 				}
 
-				return Success;
+				// Missing or outdated cache, a failing write only costs the next start
+				if (!SourceRead)
+				{
+					if (!FileBuffer.Open(Filename))
+					{
+						return false;
+					}
+					Key.Hash = static_cast<uint64_t>(strhash(FileBuffer.Data(), FileBuffer.Size()));
+				}
+				ParseFileContent(FileBuffer.Data(), FileBuffer.Size());
+				IniTraceSpan CacheSpan(m_Trace.get(), "CacheSave");
+				IniCache::Save(CacheFile, Key, m_Sections);
+				return true;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
 			bool YAIP::INIFileSave(const std::string &Filename)
 			{
+				IniStatsTimer Timer(m_Stats, IniStatsPhase::Save);
+				IniTraceSpan Span(m_Trace.get(), "INIFileSave");
+
+				if (IniSaveMode::Incremental == m_SaveMode)
+				{
+					return INIFileSaveIncremental(Filename);
+				}
+
 				bool Success = false;
 				std::ofstream IniFile;
 
@@ -144,15 +341,199 @@ namespace net
 				 */
 				if (IniFile.is_open())
 				{
-					m_Sections.sort();
-					IniFile << m_Sections.to_string();
+					{
+						IniTraceSpan SortSpan(m_Trace.get(), "sort");
+						m_Sections.sort();
+					}
+					IniTraceSpan WriteSpan(m_Trace.get(), "Write");
+					Success = Write(IniFile);
 					IniFile.close();
-					Success = true;
 				}
 
 				return Success;
 			}
 
+			// ******************************************************************
+			// ******************************************************************
+			bool YAIP::INIFileSaveIncremental(const std::string &Filename)
+			{
+				{
+					IniTraceSpan SortSpan(m_Trace.get(), "sort");
+					m_Sections.sort();
+				}
+				IniTraceSpan WriteSpan(m_Trace.get(), "WriteIncremental");
+
+				// The layout is only known for an unchanged file written by this instance
+				size_t FileSize = 0;
+				int64_t FileTime = 0;
+				bool LayoutKnown = (Filename == m_SavedFile) && FileStampGet(Filename, FileSize, FileTime) && (FileSize == m_SavedSize) && (FileTime == m_SavedTime);
+				m_SavedFile.clear();
+
+				std::fstream IniFile;
+				IniFile.open(Filename, LayoutKnown ? (std::ios::in | std::ios::out | std::ios::binary) : (std::ios::out | std::ios::trunc | std::ios::binary));
+				if (!IniFile.is_open())
+				{
+					return false;
+				}
+
+				size_t Offset = 0;
+				auto Current = m_Sections.begin();
+				if (LayoutKnown)
+				{
+					std::string Buffer;
+					for (; Current != m_Sections.end(); ++Current)
+					{
+						IniSection &Section = **Current;
+						bool InPlace = (Offset == Section.SavedOffsetGet());
+						if (InPlace && !Section.DirtyGet())
+						{
+							Offset += Section.SavedLengthGet();
+							continue;
+						}
+
+						if (!InPlace)
+						{
+							break;
+						}
+
+						Buffer.clear();
+						IniWriter SectionWriter(Buffer);
+						Section.Write(SectionWriter);
+						if (Buffer.length() != Section.SavedLengthGet())
+						{
+							break;
+						}
+
+						// Same length, overwrite the section where it is
+						IniFile.seekp(static_cast<std::streamoff>(Offset));
+						IniFile.write(Buffer.data(), static_cast<std::streamsize>(Buffer.length()));
+						Section.DirtyClear();
+						Offset += Buffer.length();
+					}
+				}
+
+				// Rewrite everything from the first section which moved or changed its length
+				IniFile.seekp(static_cast<std::streamoff>(Offset));
+				IniWriter Writer(IniFile);
+				for (; Current != m_Sections.end(); ++Current)
+				{
+					size_t Begin = Writer.SizeGet();
+					(*Current)->Write(Writer);
+					(*Current)->SavedRangeSet(Offset + Begin, Writer.SizeGet() - Begin);
+					(*Current)->DirtyClear();
+				}
+
+				bool Success = Writer.Flush();
+				size_t Size = Offset + Writer.SizeGet();
+				IniFile.close();
+				Success = Success && !IniFile.fail();
+
+				// Removed sections leave old content behind the new end
+				if (Success && LayoutKnown && (Size < FileSize))
+				{
+					Success = FileTruncate(Filename, Size);
+				}
+
+				if (Success && FileStampGet(Filename, m_SavedSize, m_SavedTime))
+				{
+					m_SavedFile = Filename;
+				}
+
+				return Success;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::InternEnable(bool Enable)
+			{
+				m_Pool.reset();
+				if (Enable)
+				{
+					m_Pool = std::make_shared<IniStringPool>(m_Resource);
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool YAIP::InternEnabled(void) const
+			{
+				return nullptr != m_Pool;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniKeyHandle YAIP::KeyHandleGet(const std::string &Section, const std::string &Key) const
+			{
+				const IniSectionPtr *CurrentSection = m_Sections.ElementLookup(Section);
+				if (nullptr != CurrentSection)
+				{
+					const IniEntryPtr *CurrentEntry = (*CurrentSection)->EntryLookup(Key, m_Pool.get());
+					if (nullptr != CurrentEntry)
+					{
+						return IniKeyHandle(*CurrentEntry, m_ValueCacheEnabled);
+					}
+				}
+
+				return IniKeyHandle();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniLoadMode YAIP::LoadModeGet(void) const
+			{
+				return m_LoadMode;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::LoadModeSet(IniLoadMode Mode)
+			{
+				m_LoadMode = Mode;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniMemoryResourcePtr YAIP::MemoryResourceGet(void) const
+			{
+				return m_Resource;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::MemoryResourceSet(const IniMemoryResourcePtr &Resource)
+			{
+				m_ArenaEnabled = false;
+				ResourceApply(Resource);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniParseMode YAIP::ParseModeGet(void) const
+			{
+				return m_ParseMode;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::ParseModeSet(IniParseMode Mode)
+			{
+				m_ParseMode = Mode;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniSaveMode YAIP::SaveModeGet(void) const
+			{
+				return m_SaveMode;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::SaveModeSet(IniSaveMode Mode)
+			{
+				m_SaveMode = Mode;
+			}
+
 			// ******************************************************************
 			// ******************************************************************
 			bool YAIP::SectionKeyKill(const std::string &Section, const std::string &Key)
@@ -166,13 +547,11 @@ namespace net
 					if (nullptr != CurrentEntry)
 					{
 						CurrentSection->EntryDelete(CurrentEntry);
+						m_Stats.DeleteCount();
 						Success = true;
 					}
 
-					if (CurrentSection->IsEmpty())
-					{
-						m_Sections.ElementDelete(CurrentSection);
-					}
+					SectionRemoveIfEmpty(CurrentSection);
 				}
 
 				return Success;
@@ -204,56 +583,59 @@ namespace net
 			// ******************************************************************
 			std::string YAIP::SectionKeyValueGet(const std::string &Section, const std::string &Key, const std::string &Default)
 			{
-				// Ensure default return value
-				std::string ReturnValue = Default;
-
-				IniSectionPtr CurrentSection = m_Sections.ElementFind(Section);
-				if (nullptr != CurrentSection)
-				{
-					IniEntryPtr CurrentEntry = CurrentSection->EntryFind(Key);
-					if (nullptr != CurrentEntry)
-					{
-						ReturnValue = CurrentEntry->ElementValueGet();
-					}
-				}
+				IniStatsTimer Timer(m_Stats, IniStatsPhase::Get);
 
-				if (0 == ReturnValue.length())
-				{
-					ReturnValue = Default;
-				}
+				// Empty values give the default
+				const IniString *Value = ValueFind(Section, Key);
+				bool Found = (nullptr != Value);
+				std::string ReturnValue = Found ? Value->str() : Default;
 
+				m_Stats.LookupCount(Found);
 				return ReturnValue;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			bool YAIP::SectionKeyValueSet(const std::string &Section, const std::string &Key, const std::string &Value)
+			tStringView YAIP::SectionKeyValueView(tStringView Section, tStringView Key, tStringView Default) const
 			{
-				IniSectionPtr CurrentSection = m_Sections.ElementFind(Section);
-				if (nullptr == CurrentSection)
-				{
-					CurrentSection.reset(new IniSection);
-					CurrentSection->ElementIdentifierSet(Section);
-					m_Sections.ElementAdd(CurrentSection);
-				}
+				IniStatsTimer Timer(m_Stats, IniStatsPhase::Get);
 
-				IniEntryPtr CurrentEntry = CurrentSection->EntryFind(Key);
-				if (nullptr != CurrentEntry)
+				const IniString *Value = ValueFind(Section, Key);
+				m_Stats.LookupCount(nullptr != Value);
+				if (nullptr != Value)
 				{
-					CurrentSection->EntryDelete(CurrentEntry);
-				}
-				else
-				{
-					CurrentEntry.reset(new IniEntry);
+					return tStringView(Value->data(), Value->length());
 				}
 
-				CurrentEntry->ElementIdentifierSet(Key);
-				CurrentEntry->ElementValueSet(Value);
-				CurrentSection->EntryAdd(CurrentEntry);
+				return Default;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool YAIP::SectionKeyValueSet(const std::string &Section, const std::string &Key, const std::string &Value)
+			{
+				IniStatsTimer Timer(m_Stats, IniStatsPhase::Set);
+
+				EntrySet(SectionFindOrAdd(Section), Key, Value);
 
 				return true;
 			}
 
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::SchemaUnbind(void)
+			{
+				m_SchemaBindings.clear();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const IniEntryList &YAIP::SectionEntriesView(tStringView Section) const
+			{
+				const IniSectionPtr *CurrentSection = m_Sections.ElementLookup(Section);
+				return (nullptr != CurrentSection) ? (*CurrentSection)->SectionEntriesView() : IniEntryList::EmptyGet();
+			}
+
 			// ******************************************************************
 			// ******************************************************************
 			tListString YAIP::SectionListGet(void)
@@ -263,35 +645,596 @@ namespace net
 
 			// ******************************************************************
 			// ******************************************************************
-			std::string YAIP::to_string(void) const
+			const IniSectionList &YAIP::SectionListView(void) const
 			{
-				return m_Sections.to_string();
+				return m_Sections;
 			}
 
 			// ******************************************************************
 			// ******************************************************************
-			void YAIP::ParseFileContent(tListString FileContent)
+			IniSnapshotPtr YAIP::SnapshotGet(void) const
 			{
-				IniSection* CurrentSectionPtr = nullptr;
+				return std::atomic_load(&m_Snapshot);
+			}
 
-				// Loop over the INI file
-				for (auto const& Loop : FileContent)
-				{
-					std::string Line = Loop;
+			// ******************************************************************
+			// ******************************************************************
+			IniSnapshotPtr YAIP::SnapshotPublish(void)
+			{
+				// Build the new version completely before readers can see it
+				IniSnapshotPtr Snapshot = std::make_shared<const IniSnapshot>(m_Sections);
+				std::atomic_store(&m_Snapshot, Snapshot);
+				return Snapshot;
+			}
 
-					// Got a new section?
-					IniSectionPtr SectionPtr(new IniSection);
-					if (SectionPtr->CreateFromRawData(Line))
-					{
-						m_Sections.ElementAdd(SectionPtr);
-						CurrentSectionPtr = SectionPtr.get();
-						continue;
-					}
+			// ******************************************************************
+			// ******************************************************************
+			IniStatsSnapshot YAIP::StatsGet(void) const
+			{
+				return m_Stats.SnapshotGet();
+			}
 
-					if (nullptr != CurrentSectionPtr)
+			// ******************************************************************
+			// ******************************************************************
+			bool YAIP::StatsEnabled(void)
+			{
+				return IniStats::Enabled;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::StatsReset(void)
+			{
+				m_Stats.Reset();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniStringPoolPtr YAIP::StringPoolGet(void) const
+			{
+				return m_Pool;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			unsigned int YAIP::ThreadCountGet(void) const
+			{
+				return m_ThreadCount;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::ThreadCountSet(unsigned int Count)
+			{
+				if (0 == Count)
+				{
+					Count = std::thread::hardware_concurrency();
+				}
+				m_ThreadCount = (0 == Count) ? 1 : Count;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::TraceEnable(bool Enable)
+			{
+				m_Trace.reset();
+				if (Enable)
+				{
+					m_Trace = std::make_shared<IniTrace>(IniTrace::DefaultCapacity);
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool YAIP::TraceEnabled(void) const
+			{
+				return nullptr != m_Trace;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniTracePtr YAIP::TraceGet(void) const
+			{
+				return m_Trace;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniTransaction YAIP::TransactionBegin(void)
+			{
+				return IniTransaction(*this);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::ValueCacheEnable(bool Enable)
+			{
+				m_ValueCacheEnabled = Enable;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool YAIP::ValueCacheEnabled(void) const
+			{
+				return m_ValueCacheEnabled;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			std::string YAIP::to_string(void) const
+			{
+				return m_Sections.to_string();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool YAIP::Write(std::ostream &Stream) const
+			{
+				IniWriter Writer(Stream);
+				m_Sections.Write(Writer);
+
+				return Writer.Flush();
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::Write(std::string &Buffer) const
+			{
+				IniWriter Writer(Buffer);
+				m_Sections.Write(Writer);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const IniEntry *YAIP::EntryLookup(tStringView Section, tStringView Key) const
+			{
+				const IniSectionPtr *CurrentSection = m_Sections.ElementLookup(Section);
+				if (nullptr != CurrentSection)
+				{
+					const IniEntryPtr *CurrentEntry = (*CurrentSection)->EntryLookup(Key, m_Pool.get());
+					if ((nullptr != CurrentEntry) && !(*CurrentEntry)->ElementValueGet().empty())
+					{
+						return CurrentEntry->get();
+					}
+				}
+
+				return nullptr;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const IniString *YAIP::ValueFind(tStringView Section, tStringView Key) const
+			{
+				const IniEntry *CurrentEntry = EntryLookup(Section, Key);
+				return (nullptr != CurrentEntry) ? &CurrentEntry->ElementValueGet() : nullptr;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniEntryPtr YAIP::EntryCreate(void)
+			{
+				// Interned strings stay valid as long as their entries keep the pool alive
+				if (nullptr != m_Pool)
+				{
+					return EntryCreate(m_Pool);
+				}
+
+				return EntryCreate(m_Resource);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniEntryPtr YAIP::EntryCreate(const IniMemoryResourcePtr &Resource)
+			{
+				return IniCreate<IniEntry>(Resource, Resource);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::EntrySet(const IniSectionPtr &Section, const std::string &Key, const std::string &Value)
+			{
+				m_Stats.SetCount();
+
+				// Existing keys are updated in place and keep their position.
+				// Values written here are not interned, the pool never releases a string.
+				const IniEntryPtr *ExistingEntry = Section->EntryLookup(Key, m_Pool.get());
+				if (nullptr != ExistingEntry)
+				{
+					(*ExistingEntry)->ElementValueSet(Value);
+					return;
+				}
+
+				// Only an entry with an interned key is allocated from the pool and may point into it
+				IniEntryPtr CurrentEntry = EntryCreate();
+				if (nullptr != m_Pool)
+				{
+					CurrentEntry->ElementIdentifierSet(Key, *m_Pool);
+				}
+				else
+				{
+					CurrentEntry->ElementIdentifierSet(Key);
+				}
+				CurrentEntry->ElementValueSet(Value);
+				Section->EntryAdd(CurrentEntry);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniSectionPtr YAIP::SectionCreate(void)
+			{
+				return SectionCreate(m_Resource);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniSectionPtr YAIP::SectionCreate(const IniMemoryResourcePtr &Resource)
+			{
+				return IniCreate<IniSection>(Resource, Resource);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			IniSectionPtr YAIP::SectionFindOrAdd(const std::string &Section)
+			{
+				IniSectionPtr CurrentSection = m_Sections.ElementFind(Section);
+				if (nullptr == CurrentSection)
+				{
+					CurrentSection = SectionCreate();
+					CurrentSection->ElementIdentifierSet(Section);
+					m_Sections.ElementAdd(CurrentSection);
+				}
+
+				return CurrentSection;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::SectionRemoveIfEmpty(const IniSectionPtr &Section)
+			{
+				if (Section->IsEmpty())
+				{
+					// The section may still be referenced, its old position becomes invalid
+					Section->SavedRangeSet(std::string::npos, 0);
+					m_Sections.ElementDelete(Section);
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::ResourceApply(const IniMemoryResourcePtr &Resource)
+			{
+				m_Resource = Resource;
+				m_Sections.ResourceSet(Resource);
+				if (nullptr != m_Pool)
+				{
+					m_Pool = std::make_shared<IniStringPool>(Resource);
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool YAIP::FileStampGet(const std::string &Filename, size_t &Size, int64_t &Time)
+			{
+#ifdef _WIN32
+				struct _stat tmpbuffer;
+				int result = _stat(Filename.c_str(), &tmpbuffer);
+#else
+				struct stat tmpbuffer;
+				int result = stat(Filename.c_str(), &tmpbuffer);
+#endif
+				if (0 != result)
+				{
+					return false;
+				}
+
+				// Seconds alone miss a change within the same second
+				Size = static_cast<size_t>(tmpbuffer.st_size);
+#if defined(_WIN32)
+				Time = static_cast<int64_t>(tmpbuffer.st_mtime) * 1000000000;
+#elif defined(__APPLE__)
+				Time = static_cast<int64_t>(tmpbuffer.st_mtimespec.tv_sec) * 1000000000 + tmpbuffer.st_mtimespec.tv_nsec;
+#else
+				Time = static_cast<int64_t>(tmpbuffer.st_mtim.tv_sec) * 1000000000 + tmpbuffer.st_mtim.tv_nsec;
+#endif
+				return true;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			bool YAIP::FileTruncate(const std::string &Filename, size_t Size)
+			{
+#ifdef _WIN32
+				int FileDescriptor = _open(Filename.c_str(), _O_RDWR | _O_BINARY);
+				if (0 > FileDescriptor)
+				{
+					return false;
+				}
+				bool Success = (0 == _chsize_s(FileDescriptor, static_cast<__int64>(Size)));
+				_close(FileDescriptor);
+				return Success;
+#else
+				return 0 == truncate(Filename.c_str(), static_cast<off_t>(Size));
+#endif
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::ParseFileContent(const tListString &FileContent)
+			{
+				IniStatsTimer Timer(m_Stats, IniStatsPhase::Parse);
+				IniTraceSpan Span(m_Trace.get(), "ParseFileContent");
+				IniTraceParseSteps Steps;
+				IniTraceParseSteps *StepsPtr = (nullptr != m_Trace) ? &Steps : nullptr;
+				IniSection* CurrentSectionPtr = nullptr;
+
+				// Loop over the INI file
+				for (auto const& Loop : FileContent)
+				{
+					ParseLine(Loop.data(), Loop.length(), CurrentSectionPtr, StepsPtr);
+				}
+
+				// The lines were split while reading the file
+				Span.ArgAdd("lines", Steps.Lines);
+				Span.ArgAdd("match_ns", Steps.Match);
+				Span.ArgAdd("add_ns", Steps.Add);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::ParseFileContent(const char *Data, size_t Length)
+			{
+				IniStatsTimer Timer(m_Stats, IniStatsPhase::Parse);
+				IniTraceSpan Span(m_Trace.get(), "ParseFileContent");
+
+				// Only the scanner detects section headers at the start of a line,
+				// which is required to split the content into independent parts.
+				// The string pool and a resource of the user are not thread safe,
+				// only arenas can be created per part.
+				size_t PartCount = std::min<size_t>(m_ThreadCount, Length / ParallelPartSize);
+				bool ResourceShared = !m_ArenaEnabled && (nullptr != m_Resource);
+				if ((IniParseMode::Scanner == m_ParseMode) && (1 < PartCount) && (nullptr == m_Pool) && !ResourceShared)
+				{
+					ParseFileContentParallel(Data, Length, PartCount);
+					return;
+				}
+
+				IniTraceParseSteps Steps;
+				IniTraceParseSteps *StepsPtr = (nullptr != m_Trace) ? &Steps : nullptr;
+				uint64_t Start = (nullptr != m_Trace) ? IniTrace::NowGet() : 0;
+				IniSection* CurrentSectionPtr = nullptr;
+				const char *End = Data + Length;
+
+				// Loop over the lines of the INI file without copying them
+				while (Data < End)
+				{
+					const char *LineEnd = static_cast<const char *>(memchr(Data, '\n', End - Data));
+					if (nullptr == LineEnd)
+					{
+						LineEnd = End;
+					}
+
+					ParseLine(Data, LineEnd - Data, CurrentSectionPtr, StepsPtr);
+					Data = LineEnd + 1;
+				}
+
+				// Anything not spent in matching or adding is spent to find the line ends
+				if (nullptr != m_Trace)
+				{
+					Steps.Split = IniTrace::NowGet() - Start - Steps.Match - Steps.Add;
+				}
+				Span.ArgAdd("lines", Steps.Lines);
+				Span.ArgAdd("split_ns", Steps.Split);
+				Span.ArgAdd("match_ns", Steps.Match);
+				Span.ArgAdd("add_ns", Steps.Add);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::ParseFileContentParallel(const char *Data, size_t Length, size_t PartCount)
+			{
+				const char *End = Data + Length;
+
+				// Move each split point forward to the next section header,
+				// the first part also holds anything in front of the first section
+				std::vector<const char *> Bounds;
+				Bounds.push_back(Data);
+				for (size_t Part = 1; Part < PartCount; ++Part)
+				{
+					const char *Split = std::max(Data + (Length / PartCount) * Part, Bounds.back());
+					Split = SectionHeaderFind(Split, End);
+					if (Split == End)
+					{
+						break;
+					}
+					if (Split > Bounds.back())
+					{
+						Bounds.push_back(Split);
+					}
+				}
+				Bounds.push_back(End);
+
+				// The arena is not thread safe, each part gets an arena of its own.
+				// The elements keep their arena alive, so nothing has to be merged.
+				std::vector<std::future<std::vector<IniSectionPtr>>> Parts;
+				for (size_t Part = 0; Part + 1 < Bounds.size(); ++Part)
+				{
+					IniMemoryResourcePtr Resource = m_ArenaEnabled ? std::make_shared<IniArena>(IniArena::DefaultBlockSize) : nullptr;
+					Parts.push_back(std::async(std::launch::async, &YAIP::ParseFilePart, Bounds[Part], static_cast<size_t>(Bounds[Part + 1] - Bounds[Part]), Resource, m_Trace.get()));
+				}
+
+				// Stitch the sections together in the original order
+				IniTraceSpan Span(m_Trace.get(), "PartsMerge");
+				for (auto &Part : Parts)
+				{
+					for (auto const &Section : Part.get())
+					{
+						m_Sections.ElementAdd(Section);
+					}
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			std::vector<IniSectionPtr> YAIP::ParseFilePart(const char *Data, size_t Length, const IniMemoryResourcePtr &Resource, IniTrace *Trace)
+			{
+				IniTraceSpan Span(Trace, "ParseFilePart");
+				Span.ArgAdd("bytes", Length);
+				std::vector<IniSectionPtr> Sections;
+				IniSection *CurrentSectionPtr = nullptr;
+				const char *End = Data + Length;
+
+				while (Data < End)
+				{
+					const char *LineEnd = static_cast<const char *>(memchr(Data, '\n', End - Data));
+					if (nullptr == LineEnd)
+					{
+						LineEnd = End;
+					}
+
+					// Same handling as ParseLine for IniParseMode::Scanner
+					IniSectionPtr SectionPtr;
+					IniEntryPtr EntryPtr;
+					ParseLineScan(Data, LineEnd - Data, nullptr != CurrentSectionPtr, Resource, nullptr, SectionPtr, EntryPtr);
+					if (nullptr != SectionPtr)
+					{
+						Sections.push_back(SectionPtr);
+						CurrentSectionPtr = SectionPtr.get();
+					}
+					else if (nullptr != EntryPtr)
+					{
+						CurrentSectionPtr->EntryAdd(EntryPtr);
+					}
+
+					Data = LineEnd + 1;
+				}
+
+				return Sections;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			const char *YAIP::SectionHeaderFind(const char *Data, const char *End)
+			{
+				IniLine Line;
+
+				while (Data < End)
+				{
+					// Skip to the start of the next line
+					const char *LineBegin = static_cast<const char *>(memchr(Data, '\n', End - Data));
+					if (nullptr == LineBegin)
+					{
+						break;
+					}
+					++LineBegin;
+
+					const char *LineEnd = static_cast<const char *>(memchr(LineBegin, '\n', End - LineBegin));
+					if (nullptr == LineEnd)
+					{
+						LineEnd = End;
+					}
+
+					if (IniScanner::ScanSection(LineBegin, LineEnd - LineBegin, Line))
+					{
+						return LineBegin;
+					}
+
+					Data = LineBegin;
+				}
+
+				return End;
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::ParseLine(const char *Data, size_t Length, IniSection *&CurrentSectionPtr, IniTraceParseSteps *Steps)
+			{
+				uint64_t Start = (nullptr != Steps) ? IniTrace::NowGet() : 0;
+
+				IniSectionPtr SectionPtr;
+				IniEntryPtr EntryPtr;
+				ParseLineMatch(Data, Length, nullptr != CurrentSectionPtr, SectionPtr, EntryPtr);
+
+				uint64_t Matched = (nullptr != Steps) ? IniTrace::NowGet() : 0;
+
+				if (nullptr != SectionPtr)
+				{
+					m_Sections.ElementAdd(SectionPtr);
+					CurrentSectionPtr = SectionPtr.get();
+				}
+				else if (nullptr != EntryPtr)
+				{
+					CurrentSectionPtr->EntryAdd(EntryPtr);
+				}
+
+				if (nullptr != Steps)
+				{
+					++Steps->Lines;
+					Steps->Match += Matched - Start;
+					Steps->Add += IniTrace::NowGet() - Matched;
+				}
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::ParseLineMatch(const char *Data, size_t Length, bool InSection, IniSectionPtr &SectionPtr, IniEntryPtr &EntryPtr)
+			{
+				if (IniParseMode::RegEx == m_ParseMode)
+				{
+					std::string Line(Data, Length);
+
+					// Got a new section?
+					SectionPtr = SectionCreate();
+					if (SectionPtr->CreateFromRawDataRegEx(Line))
+					{
+						return;
+					}
+					SectionPtr.reset();
+
+					if (InSection)
+					{
+						EntryPtr = EntryCreate();
+						if (!EntryPtr->CreateFromRawDataRegEx(Line))
+						{
+							EntryPtr.reset();
+						}
+					}
+					return;
+				}
+
+				ParseLineScan(Data, Length, InSection, m_Resource, m_Pool, SectionPtr, EntryPtr);
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void YAIP::ParseLineScan(const char *Data, size_t Length, bool InSection, const IniMemoryResourcePtr &Resource, const IniStringPoolPtr &Pool, IniSectionPtr &SectionPtr, IniEntryPtr &EntryPtr)
+			{
+				// Classify line once, allocate only for real sections and entries
+				IniLine Line;
+				switch (IniScanner::Scan(Data, Length, Line))
+				{
+				case IniLineType::Section:
+					SectionPtr = SectionCreate(Resource);
+					SectionPtr->CreateFromLine(Line);
+					break;
+				case IniLineType::Entry:
+					if (InSection)
 					{
-						CurrentSectionPtr->AddRawEntry(Line);
+						// Interned strings stay valid as long as their entries keep the pool alive
+						if (nullptr != Pool)
+						{
+							EntryPtr = EntryCreate(Pool);
+							EntryPtr->CreateFromLine(Line, *Pool);
+						}
+						else
+						{
+							EntryPtr = EntryCreate(Resource);
+							EntryPtr->CreateFromLine(Line);
+						}
 					}
+					break;
+				default:
+					// Blank lines, comments and invalid lines are skipped
+					break;
 				}
 			}
 		}
@@ -27,8 +27,21 @@
 #define _YAIP_H_
 
 #include "Convert.h"
+#include "IniArena.h"
+#include "IniCache.h"
+#include "IniEventParser.h"
+#include "IniFileBuffer.h"
+#include "IniKeyHandle.h"
+#include "IniScanner.h"
+#include "IniSchema.h"
 #include "IniSection.h"
 #include "IniSectionList.h"
+#include "IniSnapshot.h"
+#include "IniStats.h"
+#include "IniStringPool.h"
+#include "IniTrace.h"
+#include "IniTransaction.h"
+#include <cstdint>
 #include <ctype.h>
 #include <functional>
 #include <map>
@@ -53,9 +66,15 @@ namespace net
 		{
 			/**
 			 * Class to manipulate INI files
+			 * \attention Not thread safe, share the data with other threads using SnapshotPublish
 			 */
 			class YAIP
 			{
+				/**
+				 * Applies its changes directly to the internal storage
+				 */
+				friend class IniTransaction;
+
 			public:
 				/**
 				 * Default constructor
@@ -67,6 +86,40 @@ namespace net
 				 */
 				virtual ~YAIP(void);
 
+				/**
+				 * Enable or disable arena allocation of sections and entries.
+				 * With an arena all sections and entries are allocated from contiguous
+				 * blocks owned by this instance, the blocks are released at once.
+				 * Replaces a resource set by MemoryResourceSet.
+				 * \param Enable true to use an arena, false for the global heap
+				 */
+				void ArenaEnable(bool Enable);
+
+				/**
+				 * Check if sections and entries are allocated from an arena
+				 * \return true if enabled otherwise false
+				 */
+				bool ArenaEnabled(void) const;
+
+				/**
+				 * Enable or disable the binary cache. With the cache INIFileLoad looks for
+				 * a binary image of the parsed file next to the INI file, see IniCache::FilenameGet.
+				 * The image is used if size and modification time in nanoseconds of the INI file
+				 * still match. Only if the time differs the content is hashed, an image of an equal
+				 * content is kept. Otherwise the INI file is parsed and the image is written anew.
+				 * \param Enable true to use the cache, false to always parse the INI file
+				 * The cache is not used while interning is enabled or with IniParseMode::RegEx,
+				 * a loaded file is the same with or without an image.
+				 * \attention With the cache the INI file is always read memory mapped
+				 */
+				void CacheEnable(bool Enable);
+
+				/**
+				 * Check if INIFileLoad uses the binary cache
+				 * \return true if enabled otherwise false
+				 */
+				bool CacheEnabled(void) const;
+
 				/**
 				 * Drop all data to get a clean INI
 				 */
@@ -94,12 +147,96 @@ namespace net
 				bool INIFileLoad(const std::string &Filename);
 
 				/**
-				 * Save internal structures to INI file
+				 * Save internal structures to INI file. With IniSaveMode::Incremental and a
+				 * file written last by this instance, unchanged sections in front of the
+				 * first moved or resized section are kept, changed sections of the same
+				 * length are overwritten in place and only the rest of the file is rewritten.
 				 * \param Filename Full qualified filename of the INI file
 				 * \return true on success otherwise false
 				 */
 				bool INIFileSave(const std::string &Filename);
 
+				/**
+				 * Enable or disable interning of keys and values. With interning equal keys
+				 * and values of all entries created afterwards, e. g. by the next INIFileLoad,
+				 * share a single string of an IniStringPool owned by this instance.
+				 * Files are parsed by a single thread while enabled.
+				 * \param Enable true to intern into a new pool, false to use own strings
+				 */
+				void InternEnable(bool Enable);
+
+				/**
+				 * Check if keys and values are interned
+				 * \return true if enabled otherwise false
+				 */
+				bool InternEnabled(void) const;
+
+				/**
+				 * Resolve a section/key combination once for repeated access without name lookups
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \return Handle of the key, invalid if the key does not exist
+				 */
+				IniKeyHandle KeyHandleGet(const std::string &Section, const std::string &Key) const;
+
+				/**
+				 * Get the method used to read INI files
+				 * \return Current load mode
+				 */
+				IniLoadMode LoadModeGet(void) const;
+
+				/**
+				 * Set the method used to read INI files.
+				 * The default is to parse directly out of the memory mapped file.
+				 * \param Mode New load mode
+				 */
+				void LoadModeSet(IniLoadMode Mode);
+
+				/**
+				 * Get the resource sections, entries and their lists are allocated from
+				 * \return The resource, nullptr for the global heap
+				 */
+				IniMemoryResourcePtr MemoryResourceGet(void) const;
+
+				/**
+				 * Allocate sections, entries and their lists from a user supplied resource,
+				 * e. g. an IniArena on top of a fixed buffer or a shared memory segment.
+				 * Existing elements stay where they are and keep their resource alive.
+				 * Names, values and comments are IniStrings allocated from the resource as well.
+				 * Snapshots of SnapshotPublish are copies on the global heap, they outlive
+				 * the resource and do not touch it.
+				 * The resource is only used by a single thread, files are not parsed in parallel.
+				 * \param Resource Resource to allocate from, nullptr for the global heap
+				 */
+				void MemoryResourceSet(const IniMemoryResourcePtr &Resource);
+
+				/**
+				 * Get the method used to detect sections and key/value pairs
+				 * \return Current parse mode
+				 */
+				IniParseMode ParseModeGet(void) const;
+
+				/**
+				 * Set the method used to detect sections and key/value pairs.
+				 * The default is the IniScanner, the regular expressions are kept for comparison.
+				 * \param Mode New parse mode
+				 */
+				void ParseModeSet(IniParseMode Mode);
+
+				/**
+				 * Get the method used to write INI files
+				 * \return Current save mode
+				 */
+				IniSaveMode SaveModeGet(void) const;
+
+				/**
+				 * Set the method used to write INI files.
+				 * The default is to always write the whole file.
+				 * \param Mode New save mode
+				 * \attention In IniSaveMode::Incremental files are written with line feeds only on all platforms
+				 */
+				void SaveModeSet(IniSaveMode Mode);
+
 				/**
 				 * Remove key completely from section of internal data structure
 				 * \param Section Specified section
@@ -132,6 +269,17 @@ namespace net
 				 */
 				std::string SectionKeyValueGet(const std::string &Section, const std::string &Key, const std::string &Default);
 
+				/**
+				 * Method to retrieve a view of the value of the specified section/key combination
+				 * without any allocation, e. g. for keys given as string literals or pointer/length
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \param Default Specified default value in case key does not exist or is empty
+				 * \return Returns either the default value or a view of the stored value
+				 * \attention The view is valid until the key is modified or deleted
+				 */
+				tStringView SectionKeyValueView(tStringView Section, tStringView Key, tStringView Default) const;
+
 				/**
 				 * Templated method to retrieve a value of the specified section/key combination
 				 * \param Section Specified section
@@ -142,11 +290,34 @@ namespace net
 				template<typename VariableType>
 				VariableType SectionKeyValueGet(const std::string &Section, const std::string &Key, const VariableType &Default)
 				{
-					VariableType ValueReturn;
-					std::string ValueDefault;
-					Convert::ConvertTo(Default, ValueDefault);
-					std::string ValueRaw = SectionKeyValueGet(Section, Key, ValueDefault);
-					Convert::ConvertTo(ValueRaw, ValueReturn);
+					IniStatsTimer Timer(m_Stats, IniStatsPhase::Get);
+
+					// The default is returned as is, no need to convert it to std::string and back
+					VariableType ValueReturn = Default;
+					bool Found = false;
+					bool Converted = false;
+					if (m_ValueCacheEnabled)
+					{
+						const IniEntry *Entry = EntryLookup(Section, Key);
+						Found = (nullptr != Entry);
+						Converted = Found && Entry->ElementValueConvert(ValueReturn);
+					}
+					else
+					{
+						const IniString *ValueRaw = ValueFind(Section, Key);
+						Found = (nullptr != ValueRaw);
+						Converted = Found && Convert::ConvertTo(ValueRaw->str(), ValueReturn);
+					}
+
+					m_Stats.LookupCount(Found);
+					if (Found)
+					{
+						m_Stats.ConversionCount(Converted);
+						if (!Converted)
+						{
+							ValueReturn = Default;
+						}
+					}
 					return ValueReturn;
 				}
 
@@ -170,33 +341,565 @@ namespace net
 				bool SectionKeyValueSet(const std::string &Section, const std::string &Key, const VariableType &Value)
 				{
 					std::string ValueString;
-					Convert::ConvertTo(Value, ValueString);
+					m_Stats.ConversionCount(Convert::ConvertTo(Value, ValueString));
 					return SectionKeyValueSet(Section, Key, ValueString);
 				}
 
+				/**
+				 * Fill a struct with the values of all fields of a schema in a single pass.
+				 * Missing keys and values which cannot be converted get the default of the field.
+				 * \param Schema Fields to read, see IniSchemaMake
+				 * \param Target Struct to fill
+				 */
+				template<typename StructType, typename... FieldTypes>
+				void SchemaLoad(const IniSchema<StructType, FieldTypes...> &Schema, StructType &Target) const
+				{
+					SchemaReader<StructType> Reader(*this, Target);
+					Schema.ForEach(Reader);
+				}
+
+				/**
+				 * Set the values of all fields of a schema from a struct
+				 * \param Schema Fields to write, see IniSchemaMake
+				 * \param Source Struct to take the values from
+				 */
+				template<typename StructType, typename... FieldTypes>
+				void SchemaSave(const IniSchema<StructType, FieldTypes...> &Schema, const StructType &Source)
+				{
+					SchemaWriter<StructType> Writer(*this, Source);
+					Schema.ForEach(Writer);
+				}
+
+				/**
+				 * Bind a struct to a schema. The struct is filled now and again after each
+				 * successful INIFileLoad, so hot code reads plain struct members.
+				 * \param Schema Fields to read, see IniSchemaMake
+				 * \param Target Struct to fill
+				 * \attention Target must outlive the binding, see SchemaUnbind
+				 */
+				template<typename StructType, typename... FieldTypes>
+				void SchemaBind(const IniSchema<StructType, FieldTypes...> &Schema, StructType &Target)
+				{
+					SchemaLoad(Schema, Target);
+					StructType *TargetPtr = &Target;
+					m_SchemaBindings.push_back([Schema, TargetPtr](const YAIP &Parser) { Parser.SchemaLoad(Schema, *TargetPtr); });
+				}
+
+				/**
+				 * Remove all structs bound by SchemaBind
+				 */
+				void SchemaUnbind(void);
+
+				/**
+				 * Get all entries of a section without copying them. Keys, values and
+				 * comments are available by reference, e. g.
+				 * for (auto const &Entry : Parser.SectionEntriesView("Section")) Entry->ElementValueGet();
+				 * \param Section Specified section
+				 * \return Entries of the section, an empty list if the section does not exist
+				 * \attention The reference is valid until the section is modified or deleted
+				 */
+				const IniEntryList &SectionEntriesView(tStringView Section) const;
+
 				/**
 				 * Get all sections of the INI file
 				 * \return Vector with std::strings of section names
 				 */
 				tListString SectionListGet(void);
 
+				/**
+				 * Get all sections without copying them, e. g.
+				 * for (auto const &Section : Parser.SectionListView()) Section->ElementIdentifierGet();
+				 * \return All sections in their current order
+				 * \attention The reference is valid as long as this instance, iterators until it is modified
+				 */
+				const IniSectionList &SectionListView(void) const;
+
+				/**
+				 * Get the snapshot published last. Safe to call from any thread at any time,
+				 * the snapshot can be queried without locks as long as it is referenced.
+				 * \return The published snapshot, nullptr if nothing has been published yet
+				 */
+				IniSnapshotPtr SnapshotGet(void) const;
+
+				/**
+				 * Create an immutable copy of the current data and publish it atomically
+				 * to SnapshotGet. Readers still holding an older snapshot keep using it,
+				 * an old snapshot is released as soon as the last reader drops it.
+				 * The copy is allocated from the global heap, not from MemoryResourceGet.
+				 * \return The published snapshot
+				 * \attention Must not be called concurrently with modifications of this instance
+				 */
+				IniSnapshotPtr SnapshotPublish(void);
+
+				/**
+				 * Counters and latency histograms of this instance, safe to call from
+				 * other threads. All values are zero unless built with YAIP_STATS.
+				 * \return Current values
+				 */
+				IniStatsSnapshot StatsGet(void) const;
+
+				/**
+				 * Check if counters and latency histograms are compiled in
+				 * \return true if built with YAIP_STATS otherwise false
+				 */
+				static bool StatsEnabled(void);
+
+				/**
+				 * Set all counters and latency histograms to zero
+				 */
+				void StatsReset(void);
+
+				/**
+				 * Get the pool of interned keys and values, e. g. for its size
+				 * \return The pool, nullptr if interning is disabled
+				 */
+				IniStringPoolPtr StringPoolGet(void) const;
+
+				/**
+				 * Get the number of threads used to parse a loaded file
+				 * \return Number of threads
+				 */
+				unsigned int ThreadCountGet(void) const;
+
+				/**
+				 * Set the number of threads used to parse a loaded file. With more than one
+				 * thread, files loaded in IniLoadMode::Mapped and IniParseMode::Scanner are
+				 * split at section headers and the parts are parsed concurrently. The result
+				 * is identical to parsing with a single thread. Files are parsed by a single
+				 * thread while a resource is set by MemoryResourceSet or interning is enabled.
+				 * \param Count Number of threads, 0 for the number of hardware threads
+				 */
+				void ThreadCountSet(unsigned int Count);
+
+				/**
+				 * Enable or disable tracing. With tracing load, parse, save and sort record
+				 * spans into a ring buffer, see IniTrace::ChromeJsonSave for the export.
+				 * \param Enable true to record spans into a new trace, false to stop
+				 */
+				void TraceEnable(bool Enable);
+
+				/**
+				 * Check if spans are recorded
+				 * \return true if enabled otherwise false
+				 */
+				bool TraceEnabled(void) const;
+
+				/**
+				 * Get the recorded spans
+				 * \return The trace, nullptr if disabled
+				 */
+				IniTracePtr TraceGet(void) const;
+
+				/**
+				 * Start collecting changes to apply them at once, see IniTransaction
+				 * \return Empty transaction for this instance
+				 */
+				IniTransaction TransactionBegin(void);
+
+				/**
+				 * Enable or disable the typed value cache. With the cache each entry keeps
+				 * the value converted last by the templated SectionKeyValueGet, SchemaLoad,
+				 * key handles and IniLayers, repeated reads of the same type skip the
+				 * conversion until the value is changed.
+				 * \param Enable true to use the cache, false to always convert
+				 */
+				void ValueCacheEnable(bool Enable);
+
+				/**
+				 * Check if the typed value cache is used
+				 * \return true if enabled otherwise false
+				 */
+				bool ValueCacheEnabled(void) const;
+
 				/**
 				 * String representation of whole INI file
 				 * \return String representation of an INI entry
 				 */
 				std::string to_string(void) const;
 
+				/**
+				 * Write whole INI file to a stream in large chunks
+				 * \param Stream Stream to write to
+				 * \return true on success otherwise false
+				 */
+				bool Write(std::ostream &Stream) const;
+
+				/**
+				 * Append whole INI file to a buffer, e. g. reused for repeated serialization
+				 * \param Buffer Buffer to append to
+				 */
+				void Write(std::string &Buffer) const;
+
 			protected:
 				/**
 				 * List of all sections
 				 */
 				IniSectionList m_Sections;
 
+				/**
+				 * Resource for sections, entries and their lists, nullptr for the global heap
+				 */
+				IniMemoryResourcePtr m_Resource;
+
+				/**
+				 * Flag if m_Resource is an arena created by ArenaEnable, renewed by Clear once used
+				 */
+				bool m_ArenaEnabled;
+
+				/**
+				 * Pool of interned keys and values on top of m_Resource, nullptr if disabled.
+				 * Entries are allocated from the pool and keep it alive.
+				 */
+				IniStringPoolPtr m_Pool;
+
+				/**
+				 * Create a new entry, allocated from the resource if set
+				 * \return The new entry
+				 */
+				IniEntryPtr EntryCreate(void);
+
+				/**
+				 * Create a new entry
+				 * \param Resource Resource to allocate from, nullptr for the global heap
+				 * \return The new entry
+				 */
+				static IniEntryPtr EntryCreate(const IniMemoryResourcePtr &Resource);
+
+				/**
+				 * Update an existing key in place or append a new one, only a new key is interned.
+				 * Shared by SectionKeyValueSet and IniTransaction::Commit.
+				 * \param Section Section to set the key in
+				 * \param Key Specified key
+				 * \param Value Specified value to set, owned by the entry
+				 */
+				void EntrySet(const IniSectionPtr &Section, const std::string &Key, const std::string &Value);
+
+				/**
+				 * Flag if INIFileLoad uses the binary cache
+				 */
+				bool m_CacheEnabled;
+
+				/**
+				 * Find the entry of a section/key combination
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \return Pointer to the entry, nullptr if the key does not exist or the value is empty
+				 */
+				const IniEntry *EntryLookup(tStringView Section, tStringView Key) const;
+
+				/**
+				 * Fills a struct field by field, see SchemaLoad
+				 */
+				template<typename StructType>
+				class SchemaReader
+				{
+				public:
+					/**
+					 * Constructor
+					 * \param Parser Instance to read from
+					 * \param Target Struct to fill
+					 */
+					SchemaReader(const YAIP &Parser, StructType &Target)
+						: m_Parser(Parser)
+						, m_Target(Target)
+					{
+					}
+
+					/**
+					 * Read one field
+					 * \param Field Field description
+					 */
+					template<typename VariableType>
+					void operator()(const IniSchemaField<StructType, VariableType> &Field)
+					{
+						VariableType &Value = m_Target.*(Field.Member);
+						const IniEntry *Entry = m_Parser.EntryLookup(Field.Section, Field.Key);
+						if ((nullptr == Entry) || !SchemaValueRead(*Entry, Value, m_Parser.m_ValueCacheEnabled))
+						{
+							Value = Field.Default;
+						}
+					}
+
+				private:
+					/**
+					 * Instance to read from
+					 */
+					const YAIP &m_Parser;
+
+					/**
+					 * Struct to fill
+					 */
+					StructType &m_Target;
+				};
+
+				/**
+				 * Sets the values of a struct field by field, see SchemaSave
+				 */
+				template<typename StructType>
+				class SchemaWriter
+				{
+				public:
+					/**
+					 * Constructor
+					 * \param Parser Instance to write to
+					 * \param Source Struct to take the values from
+					 */
+					SchemaWriter(YAIP &Parser, const StructType &Source)
+						: m_Parser(Parser)
+						, m_Source(Source)
+					{
+					}
+
+					/**
+					 * Write one field
+					 * \param Field Field description
+					 */
+					template<typename VariableType>
+					void operator()(const IniSchemaField<StructType, VariableType> &Field)
+					{
+						m_Parser.SectionKeyValueSet(Field.Section, Field.Key, m_Source.*(Field.Member));
+					}
+
+				private:
+					/**
+					 * Instance to write to
+					 */
+					YAIP &m_Parser;
+
+					/**
+					 * Struct to take the values from
+					 */
+					const StructType &m_Source;
+				};
+
+				/**
+				 * Structs bound by SchemaBind, refreshed after each INIFileLoad
+				 */
+				std::vector<std::function<void(const YAIP &)>> m_SchemaBindings;
+
+				/**
+				 * Convert the value of an entry for a schema field
+				 * \param Entry Entry to read
+				 * \param Value Receives the value
+				 * \param Cache true to use the typed value cache, see ValueCacheEnable
+				 * \return true on success otherwise false
+				 */
+				template<typename VariableType>
+				static bool SchemaValueRead(const IniEntry &Entry, VariableType &Value, bool Cache)
+				{
+					return Entry.ElementValueConvert(Value, Cache);
+				}
+
+				/**
+				 * Take over the value of an entry for a schema field of type std::string
+				 * \param Entry Entry to read
+				 * \param Value Receives the value
+				 * \param Cache Unused, strings are never cached
+				 * \return Always true
+				 */
+				static bool SchemaValueRead(const IniEntry &Entry, std::string &Value, bool Cache)
+				{
+					(void)Cache;
+					Value = Entry.ElementValueGet().str();
+					return true;
+				}
+
+				/**
+				 * Find the stored value of a section/key combination
+				 * \param Section Specified section
+				 * \param Key Specified key
+				 * \return Pointer to the value, nullptr if the key does not exist or the value is empty
+				 */
+				const IniString *ValueFind(tStringView Section, tStringView Key) const;
+
+				/**
+				 * Create a new section, allocated from the resource if set
+				 * \return The new section
+				 */
+				IniSectionPtr SectionCreate(void);
+
+				/**
+				 * Create a new section, its list of entries uses the same resource
+				 * \param Resource Resource to allocate from, nullptr for the global heap
+				 * \return The new section
+				 */
+				static IniSectionPtr SectionCreate(const IniMemoryResourcePtr &Resource);
+
+				/**
+				 * Find a section, a missing one is created and appended
+				 * \param Section Specified section
+				 * \return The existing or new section
+				 */
+				IniSectionPtr SectionFindOrAdd(const std::string &Section);
+
+				/**
+				 * Remove a section left empty by deleted keys
+				 * \param Section Section to check
+				 */
+				void SectionRemoveIfEmpty(const IniSectionPtr &Section);
+
+				/**
+				 * Use another resource for new elements and the list of sections
+				 * \param Resource Resource to allocate from, nullptr for the global heap
+				 */
+				void ResourceApply(const IniMemoryResourcePtr &Resource);
+
+				/**
+				 * Method used to read INI files
+				 */
+				IniLoadMode m_LoadMode;
+
+				/**
+				 * Method used to detect sections and key/value pairs
+				 */
+				IniParseMode m_ParseMode;
+
+				/**
+				 * Method used to write INI files
+				 */
+				IniSaveMode m_SaveMode;
+
+				/**
+				 * File written last in IniSaveMode::Incremental, empty if unknown
+				 */
+				std::string m_SavedFile;
+
+				/**
+				 * Size of the file written last
+				 */
+				size_t m_SavedSize;
+
+				/**
+				 * Modification time of the file written last in nanoseconds, see FileStampGet
+				 */
+				int64_t m_SavedTime;
+
+				/**
+				 * Snapshot published last, only accessed using std::atomic_load/std::atomic_store
+				 */
+				IniSnapshotPtr m_Snapshot;
+
+				/**
+				 * Counters and latency histograms, updated by const lookups too
+				 */
+				mutable IniStats m_Stats;
+
+				/**
+				 * Number of threads used to parse a loaded file
+				 */
+				unsigned int m_ThreadCount;
+
+				/**
+				 * Spans of load, parse and save, nullptr if disabled
+				 */
+				IniTracePtr m_Trace;
+
+				/**
+				 * Flag if the typed value cache is used
+				 */
+				bool m_ValueCacheEnabled;
+
+				/**
+				 * Get size and modification time of a file
+				 * \param Filename Full qualified filename
+				 * \param Size Receives the size in bytes
+				 * \param Time Receives the modification time in nanoseconds since the epoch, Windows only reports seconds
+				 * \return true on success otherwise false
+				 */
+				static bool FileStampGet(const std::string &Filename, size_t &Size, int64_t &Time);
+
+				/**
+				 * Cut a file to the given size
+				 * \param Filename Full qualified filename
+				 * \param Size New size in bytes
+				 * \return true on success otherwise false
+				 */
+				static bool FileTruncate(const std::string &Filename, size_t Size);
+
+				/**
+				 * Save in IniSaveMode::Incremental, see INIFileSave
+				 * \param Filename Full qualified filename of the INI file
+				 * \return true on success otherwise false
+				 */
+				bool INIFileSaveIncremental(const std::string &Filename);
+
+				/**
+				 * Load using the binary cache, see CacheEnable
+				 * \param Filename Full qualified filename of the INI file
+				 * \return true on success otherwise false
+				 */
+				bool INIFileLoadCached(const std::string &Filename);
+
+				/**
+				 * Loop over file content to determine sections and key/values to populate internal storage
+				 * \param Data The INI file content, lines separated by line feeds
+				 * \param Length Length of the content
+				 */
+				void ParseFileContent(const char *Data, size_t Length);
+
 				/**
 				 * Loop over file content to determine sections and key/values to populate internal storage
 				 * \param FileContent The INI file as a vector of std::strings, each line a string
 				 */
-				void ParseFileContent(tListString FileContent);
+				void ParseFileContent(const tListString &FileContent);
+
+				/**
+				 * Split file content at section headers and parse the parts concurrently
+				 * \param Data The INI file content, lines separated by line feeds
+				 * \param Length Length of the content
+				 * \param PartCount Number of parts to split into
+				 */
+				void ParseFileContentParallel(const char *Data, size_t Length, size_t PartCount);
+
+				/**
+				 * Parse a part of the file content on its own, used by the worker threads
+				 * \param Data Start of the part, a section header or the start of the file
+				 * \param Length Length of the part
+				 * \param Resource Resource to allocate from, nullptr for the global heap
+				 * \param Trace Trace to record into, nullptr if disabled
+				 * \return All sections of the part in order of appearance
+				 */
+				static std::vector<IniSectionPtr> ParseFilePart(const char *Data, size_t Length, const IniMemoryResourcePtr &Resource, IniTrace *Trace);
+
+				/**
+				 * Find the start of the next line containing a section header
+				 * \param Data Position to start searching, does not need to be the start of a line
+				 * \param End End of the file content
+				 * \return Start of the section header line or End if there is none
+				 */
+				static const char *SectionHeaderFind(const char *Data, const char *End);
+
+				/**
+				 * Determine section or key/value of a single line and populate internal storage
+				 * \param Data Start of the line
+				 * \param Length Length of the line
+				 * \param CurrentSectionPtr Section the entries are added to, updated on a new section
+				 * \param Steps Receives the time spent per step, nullptr if not traced
+				 */
+				void ParseLine(const char *Data, size_t Length, IniSection *&CurrentSectionPtr, IniTraceParseSteps *Steps);
+
+				/**
+				 * Create the section or entry of a single line without adding it
+				 * \param Data Start of the line
+				 * \param Length Length of the line
+				 * \param InSection Flag if a section was found before, otherwise entries are skipped
+				 * \param SectionPtr Receives the new section, nullptr if the line is no section
+				 * \param EntryPtr Receives the new entry, nullptr if the line is no entry
+				 */
+				void ParseLineMatch(const char *Data, size_t Length, bool InSection, IniSectionPtr &SectionPtr, IniEntryPtr &EntryPtr);
+
+				/**
+				 * Create the section or entry of a single line using the scanner, shared by
+				 * ParseLineMatch and the worker threads
+				 * \param Data Start of the line
+				 * \param Length Length of the line
+				 * \param InSection Flag if a section was found before, otherwise entries are skipped
+				 * \param Resource Resource to allocate from, nullptr for the global heap
+				 * \param Pool Pool to intern key and value and to allocate entries from, nullptr to not intern
+				 * \param SectionPtr Receives the new section, nullptr if the line is no section
+				 * \param EntryPtr Receives the new entry, nullptr if the line is no entry
+				 */
+				static void ParseLineScan(const char *Data, size_t Length, bool InSection, const IniMemoryResourcePtr &Resource, const IniStringPoolPtr &Pool, IniSectionPtr &SectionPtr, IniEntryPtr &EntryPtr);
 			};
 		}
 	}
@@ -61,20 +61,60 @@ namespace net
 
 			// ******************************************************************
 			// ******************************************************************
-			bool strcmpcaseless(const std::string& left, const std::string& right)
+			bool strcmpcaseless(tStringView left, tStringView right)
 			{
-				return std::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end(), [](char first, char second)
+				return std::lexicographical_compare(left.data(), left.data() + left.length(), right.data(), right.data() + right.length(), [](char first, char second)
 					{
 						return tolower(first) < tolower(second);
 					});
 			}
 
+			// ******************************************************************
+			// ******************************************************************
+			size_t strhash(const char* data, size_t length)
+			{
+				unsigned long long hash = 14695981039346656037ULL;
+
+				for (size_t index = 0; index < length; ++index)
+				{
+					hash ^= static_cast<unsigned char>(data[index]);
+					hash *= 1099511628211ULL;
+				}
+
+				return static_cast<size_t>(hash);
+			}
+
 			// ******************************************************************
 			// ******************************************************************
 			std::string trim(const std::string& in)
 			{
 				return rtrim(ltrim(in));
 			}
+
+			// ******************************************************************
+			// ******************************************************************
+			tStringView trimview(tStringView in)
+			{
+				const char* begin = in.data();
+				const char* end = begin + in.length();
+				trimrange(begin, end);
+				return tStringView(begin, static_cast<size_t>(end - begin));
+			}
+
+			// ******************************************************************
+			// ******************************************************************
+			void trimrange(const char*& begin, const char*& end)
+			{
+				while ((begin < end) && (std::string::npos != WHITESPACE.find(*begin)))
+				{
+					++begin;
+				}
+
+				while ((end > begin) && (std::string::npos != WHITESPACE.find(*(end - 1))))
+				{
+					--end;
+				}
+			}
 		}
 	}
 }
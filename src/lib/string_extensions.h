@@ -26,8 +26,14 @@
 #ifndef _STRING_EXTENSIONS_H_
 #define _STRING_EXTENSIONS_H_
 
+#include <cstring>
 #include <string>
 
+#if (__cplusplus >= 201703L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L))
+#include <string_view>
+#define YAIP_HAS_STRING_VIEW
+#endif
+
  /**
   * Namespace of YAIP
   */
@@ -43,6 +49,129 @@ namespace net
 		 */
 		namespace yaip
 		{
+#ifdef YAIP_HAS_STRING_VIEW
+			/**
+			 * Non owning view of characters, std::string_view when built as C++17
+			 */
+			typedef std::string_view tStringView;
+#else
+			/**
+			 * Non owning view of characters, replacement of std::string_view before C++17
+			 */
+			class tStringView
+			{
+			public:
+				/**
+				 * Empty view
+				 */
+				tStringView(void)
+					: m_Data("")
+					, m_Length(0)
+				{
+				}
+
+				/**
+				 * View of a zero terminated string
+				 * \param Data Zero terminated string
+				 */
+				tStringView(const char *Data)
+					: m_Data(Data)
+					, m_Length(strlen(Data))
+				{
+				}
+
+				/**
+				 * View of pointer and length
+				 * \param Data Start of characters
+				 * \param Length Number of characters
+				 */
+				tStringView(const char *Data, size_t Length)
+					: m_Data(Data)
+					, m_Length(Length)
+				{
+				}
+
+				/**
+				 * View of a std::string
+				 * \param Data String to view, has to outlive the view
+				 */
+				tStringView(const std::string &Data)
+					: m_Data(Data.data())
+					, m_Length(Data.length())
+				{
+				}
+
+				/**
+				 * Start of the view, not zero terminated
+				 * \return Start of characters
+				 */
+				const char *data(void) const
+				{
+					return m_Data;
+				}
+
+				/**
+				 * Check for empty view
+				 * \return true if empty otherwise false
+				 */
+				bool empty(void) const
+				{
+					return 0 == m_Length;
+				}
+
+				/**
+				 * Length of the view
+				 * \return Number of characters
+				 */
+				size_t length(void) const
+				{
+					return m_Length;
+				}
+
+				/**
+				 * Length of the view
+				 * \return Number of characters
+				 */
+				size_t size(void) const
+				{
+					return m_Length;
+				}
+
+			private:
+				/**
+				 * Start of characters
+				 */
+				const char *m_Data;
+
+				/**
+				 * Number of characters
+				 */
+				size_t m_Length;
+			};
+
+			/**
+			 * Compare two views for equal content
+			 * \param Left Left view
+			 * \param Right Right view
+			 * \return true on equal content, otherwise false
+			 */
+			inline bool operator==(const tStringView &Left, const tStringView &Right)
+			{
+				return (Left.length() == Right.length()) && (0 == memcmp(Left.data(), Right.data(), Left.length()));
+			}
+
+			/**
+			 * Compare two views for different content
+			 * \param Left Left view
+			 * \param Right Right view
+			 * \return true on different content, otherwise false
+			 */
+			inline bool operator!=(const tStringView &Left, const tStringView &Right)
+			{
+				return !(Left == Right);
+			}
+#endif
+
 			/**
 			 * Defined whitepaces to trim
 			 */
@@ -68,7 +197,15 @@ namespace net
 			 * \param right Right string
 			 * \return True on equal, otherwise false
 			 */
-			bool strcmpcaseless(const std::string& left, const std::string& right);
+			bool strcmpcaseless(tStringView left, tStringView right);
+
+			/**
+			 * Hash a range of characters (FNV-1a), no allocation
+			 * \param data Start of range
+			 * \param length Length of range
+			 * \return Hash value
+			 */
+			size_t strhash(const char* data, size_t length);
 
 			/**
 			 * Trim whitespaces from both sides of string
@@ -76,6 +213,20 @@ namespace net
 			 * \return Trimmed string
 			 */
 			std::string trim(const std::string& in);
+
+			/**
+			 * Trim whitespaces from both sides of a range without copying it
+			 * \param begin Start of range, moved behind leading whitespaces
+			 * \param end End of range, moved before trailing whitespaces
+			 */
+			void trimrange(const char*& begin, const char*& end);
+
+			/**
+			 * Trim whitespaces from both sides of a view without copying it
+			 * \param in View to trim
+			 * \return Trimmed view
+			 */
+			tStringView trimview(tStringView in);
 		}
 	}
 }
@@ -21,8 +21,12 @@
 #define _TEST_YAIP_H_
 
 #include "catch2/catch.hpp"
+#include "IniLayers.h"
 #include "YAIP.h"
+#include <fstream>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <limits>
 #include <vector>
 
@@ -278,4 +282,966 @@ TEST_CASE("Test sorting of INI file", "[YAIP]")
 	REQUIRE(!sut.INIFileExist(S_FILE_INI));
 }
 
+TEST_CASE("Test parse modes of YAIP", "[YAIP]")
+{
+	std::ofstream IniFile(S_FILE_INI, std::ios::trunc);
+	IniFile << "; leading comment" << std::endl;
+	IniFile << "orphan = before any section" << std::endl;
+	IniFile << "[Section002] ; second" << std::endl;
+	IniFile << "  key02 = value02 ; comment02" << std::endl;
+	IniFile << "key01=value01" << std::endl;
+	IniFile << "" << std::endl;
+	IniFile << "invalid line" << std::endl;
+	IniFile << "[ Section001 ]" << std::endl;
+	IniFile << "key = a=b ; c ; d\r" << std::endl;
+	IniFile.close();
+
+	net::derpaul::yaip::YAIP sut;
+	REQUIRE(net::derpaul::yaip::IniParseMode::Scanner == sut.ParseModeGet());
+	REQUIRE(sut.INIFileLoad(S_FILE_INI));
+	std::string INIScanner = sut.to_string();
+
+	sut.ParseModeSet(net::derpaul::yaip::IniParseMode::RegEx);
+	REQUIRE(sut.INIFileLoad(S_FILE_INI));
+	std::string INIRegEx = sut.to_string();
+
+	std::string INIExpected = "[Section002] ; second\nkey02 = value02 ; comment02\nkey01 = value01\n\n[Section001]\nkey = a=b ; c ; d\n\n";
+	REQUIRE(INIExpected == INIScanner);
+	REQUIRE(INIExpected == INIRegEx);
+
+	sut.INIFileDelete(S_FILE_INI);
+	REQUIRE(!sut.INIFileExist(S_FILE_INI));
+}
+
+TEST_CASE("Test load modes of YAIP", "[YAIP]")
+{
+	std::ofstream IniFile(S_FILE_INI, std::ios::trunc | std::ios::binary);
+	IniFile << "[Section001]\r\nkey01 = value01\r\n\r\n[Section002] ; comment\nkey02 = value02 ; comment02";
+	IniFile.close();
+
+	net::derpaul::yaip::YAIP sut;
+	REQUIRE(net::derpaul::yaip::IniLoadMode::Mapped == sut.LoadModeGet());
+	REQUIRE(sut.INIFileLoad(S_FILE_INI));
+	std::string INIMapped = sut.to_string();
+
+	sut.LoadModeSet(net::derpaul::yaip::IniLoadMode::Stream);
+	REQUIRE(sut.INIFileLoad(S_FILE_INI));
+	std::string INIStream = sut.to_string();
+
+	std::string INIExpected = "[Section001]\nkey01 = value01\n\n[Section002] ; comment\nkey02 = value02 ; comment02\n\n";
+	REQUIRE(INIExpected == INIMapped);
+	REQUIRE(INIExpected == INIStream);
+
+	net::derpaul::yaip::IniFileBuffer FileBuffer;
+	REQUIRE(FileBuffer.Open(S_FILE_INI));
+	REQUIRE(0 < FileBuffer.Size());
+	FileBuffer.Close();
+	REQUIRE(0 == FileBuffer.Size());
+
+	sut.INIFileDelete(S_FILE_INI);
+	REQUIRE(!sut.INIFileExist(S_FILE_INI));
+	REQUIRE(!FileBuffer.Open(S_FILE_INI));
+
+	sut.LoadModeSet(net::derpaul::yaip::IniLoadMode::Mapped);
+	REQUIRE(!sut.INIFileLoad(S_FILE_INI));
+}
+
+TEST_CASE("Test arena allocation of YAIP", "[YAIP]")
+{
+	net::derpaul::yaip::YAIP reference;
+	net::derpaul::yaip::YAIP sut;
+
+	REQUIRE(!sut.ArenaEnabled());
+	sut.ArenaEnable(true);
+	REQUIRE(sut.ArenaEnabled());
+
+	for (int Section = 0; Section < 50; ++Section)
+	{
+		for (int Key = 0; Key < 20; ++Key)
+		{
+			std::string SectionName = "Section" + std::to_string(Section);
+			std::string KeyName = "Key" + std::to_string(Key);
+			std::string Value = "Value " + std::to_string(Section * Key);
+			reference.SectionKeyValueSet(SectionName, KeyName, Value);
+			sut.SectionKeyValueSet(SectionName, KeyName, Value);
+		}
+	}
+	REQUIRE(reference.to_string() == sut.to_string());
+
+	REQUIRE(reference.INIFileSave(S_FILE_INI));
+	REQUIRE(sut.INIFileLoad(S_FILE_INI));
+	REQUIRE(reference.to_string() == sut.to_string());
+	REQUIRE("Value 12" == sut.SectionKeyValueGet(std::string("Section3"), std::string("Key4"), std::string()));
+
+	net::derpaul::yaip::IniMemoryResourcePtr Arena = sut.MemoryResourceGet();
+	sut.Clear();
+	REQUIRE(sut.ArenaEnabled());
+	REQUIRE(sut.SectionListGet().empty());
+	REQUIRE(Arena != sut.MemoryResourceGet());
+
+	INFO("An unused arena is kept");
+	Arena = sut.MemoryResourceGet();
+	sut.Clear();
+	REQUIRE(Arena == sut.MemoryResourceGet());
+
+	sut.INIFileDelete(S_FILE_INI);
+	REQUIRE(!sut.INIFileExist(S_FILE_INI));
+}
+
+TEST_CASE("Test parallel parsing of YAIP", "[YAIP]")
+{
+	std::ofstream IniFile(S_FILE_INI, std::ios::trunc | std::ios::binary);
+	IniFile << "; leading comment\norphan = before any section\n";
+	for (int Section = 0; Section < 2000; ++Section)
+	{
+		// Duplicate sections and keys have to end up in the original order
+		IniFile << "[Section" << (Section % 1500) << "] ; comment\n";
+		for (int Key = 0; Key < 20; ++Key)
+		{
+			IniFile << "  Key" << (Key % 15) << " = Value " << (Section * Key) << " ; comment\r\n";
+		}
+		IniFile << "invalid line\n\n";
+	}
+	IniFile << "[Last]\nkey = value without line feed";
+	IniFile.close();
+
+	net::derpaul::yaip::YAIP reference;
+	REQUIRE(reference.INIFileLoad(S_FILE_INI));
+
+	net::derpaul::yaip::YAIP sut;
+	REQUIRE(1 == sut.ThreadCountGet());
+	sut.ThreadCountSet(0);
+	REQUIRE(0 < sut.ThreadCountGet());
+
+	for (unsigned int Threads : { 2U, 3U, 8U, 64U })
+	{
+		INFO("Threads " + std::to_string(Threads));
+		sut.ThreadCountSet(Threads);
+		REQUIRE(sut.INIFileLoad(S_FILE_INI));
+		REQUIRE(reference.to_string() == sut.to_string());
+		REQUIRE(reference.SectionListGet() == sut.SectionListGet());
+		REQUIRE("Value 15" == sut.SectionKeyValueGet(std::string("Section5"), std::string("Key3"), std::string()));
+		REQUIRE("value without line feed" == sut.SectionKeyValueGet(std::string("Last"), std::string("key"), std::string()));
+
+		sut.ArenaEnable(true);
+		REQUIRE(sut.INIFileLoad(S_FILE_INI));
+		REQUIRE(reference.to_string() == sut.to_string());
+		sut.ArenaEnable(false);
+	}
+
+	sut.INIFileDelete(S_FILE_INI);
+	REQUIRE(!sut.INIFileExist(S_FILE_INI));
+}
+
+TEST_CASE("Test snapshots of YAIP", "[YAIP]")
+{
+	net::derpaul::yaip::YAIP sut;
+	REQUIRE(nullptr == sut.SnapshotGet());
+
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, S_KEY, 1));
+	net::derpaul::yaip::IniSnapshotPtr First = sut.SnapshotPublish();
+	REQUIRE(First == sut.SnapshotGet());
+
+	INFO("Published snapshots are not affected by later modifications");
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, S_KEY, 2));
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, S_KEY_INVALID, std::string("new")));
+	REQUIRE(1 == First->SectionKeyValueGet(S_SECTION, S_KEY, 0));
+	REQUIRE("default" == First->SectionKeyValueGet(S_SECTION, S_KEY_INVALID, std::string("default")));
+	REQUIRE(1 == First->SectionKeyListGet(S_SECTION).size());
+
+	net::derpaul::yaip::IniSnapshotPtr Second = sut.SnapshotPublish();
+	REQUIRE(2 == Second->SectionKeyValueGet(S_SECTION, S_KEY, 0));
+	REQUIRE("new" == std::string(Second->SectionKeyValueView(S_SECTION, S_KEY_INVALID, "").data(), 3));
+	REQUIRE(sut.to_string() == Second->to_string());
+	REQUIRE(sut.SectionListGet() == Second->SectionListGet());
+
+	INFO("Old versions are released once no reader holds them");
+	std::weak_ptr<const net::derpaul::yaip::IniSnapshot> Observer = First;
+	First.reset();
+	REQUIRE(Observer.expired());
+
+	INFO("Readers always see a consistent version while a writer publishes");
+	bool Consistent = true;
+	std::vector<std::thread> Readers;
+	std::vector<char> Results(4, 1);
+	for (size_t Reader = 0; Reader < Results.size(); ++Reader)
+	{
+		Readers.push_back(std::thread([&sut, &Results, Reader]()
+		{
+			for (int Loop = 0; Loop < 2000; ++Loop)
+			{
+				net::derpaul::yaip::IniSnapshotPtr Snapshot = sut.SnapshotGet();
+				int Left = Snapshot->SectionKeyValueGet(S_SECTION, "LEFT", -1);
+				int Right = Snapshot->SectionKeyValueGet(S_SECTION, "RIGHT", -1);
+				Results[Reader] &= (Left == Right) ? 1 : 0;
+			}
+		}));
+	}
+	for (int Version = 0; Version < 200; ++Version)
+	{
+		sut.SectionKeyValueSet(S_SECTION, "LEFT", Version);
+		sut.SectionKeyValueSet(S_SECTION, "RIGHT", Version);
+		sut.SnapshotPublish();
+	}
+	for (auto &Reader : Readers)
+	{
+		Reader.join();
+	}
+	for (auto Result : Results)
+	{
+		Consistent = Consistent && (1 == Result);
+	}
+	REQUIRE(Consistent);
+}
+
+TEST_CASE("Test serialization of YAIP", "[YAIP]")
+{
+	net::derpaul::yaip::YAIP sut;
+	for (int Section = 0; Section < 200; ++Section)
+	{
+		for (int Key = 0; Key < 50; ++Key)
+		{
+			sut.SectionKeyValueSet("Section" + std::to_string(Section), "Key" + std::to_string(Key), Section * Key);
+		}
+	}
+
+	std::string Expected = sut.to_string();
+
+	std::ostringstream Stream;
+	REQUIRE(sut.Write(Stream));
+	REQUIRE(Expected == Stream.str());
+
+	std::string Buffer;
+	sut.Write(Buffer);
+	sut.Write(Buffer);
+	REQUIRE(Expected + Expected == Buffer);
+
+	REQUIRE(sut.INIFileSave(S_FILE_INI));
+	net::derpaul::yaip::YAIP loaded;
+	REQUIRE(loaded.INIFileLoad(S_FILE_INI));
+	REQUIRE(sut.to_string() == loaded.to_string());
+
+	sut.INIFileDelete(S_FILE_INI);
+	REQUIRE(!sut.INIFileExist(S_FILE_INI));
+}
+
+static std::string FileContentGet(const std::string &Filename)
+{
+	std::ifstream IniFile(Filename, std::ios::in | std::ios::binary);
+	std::ostringstream Content;
+	Content << IniFile.rdbuf();
+	return Content.str();
+}
+
+TEST_CASE("Test incremental save of YAIP", "[YAIP]")
+{
+	net::derpaul::yaip::YAIP sut;
+	REQUIRE(net::derpaul::yaip::IniSaveMode::Full == sut.SaveModeGet());
+	sut.SaveModeSet(net::derpaul::yaip::IniSaveMode::Incremental);
+	REQUIRE(net::derpaul::yaip::IniSaveMode::Incremental == sut.SaveModeGet());
+
+	for (int Section = 10; Section < 60; ++Section)
+	{
+		for (int Key = 10; Key < 30; ++Key)
+		{
+			sut.SectionKeyValueSet("Section" + std::to_string(Section), "Key" + std::to_string(Key), Section * Key);
+		}
+	}
+
+	INFO("First save writes the whole file");
+	REQUIRE(sut.INIFileSave(S_FILE_INI));
+	REQUIRE(sut.to_string() == FileContentGet(S_FILE_INI));
+
+	INFO("Same length is overwritten in place");
+	sut.SectionKeyValueSet("Section20", "Key20", 999);
+	REQUIRE(sut.INIFileSave(S_FILE_INI));
+	REQUIRE(sut.to_string() == FileContentGet(S_FILE_INI));
+
+	INFO("Longer value rewrites the rest of the file");
+	sut.SectionKeyValueSet("Section30", "Key11", std::string("a longer value than before"));
+	REQUIRE(sut.INIFileSave(S_FILE_INI));
+	REQUIRE(sut.to_string() == FileContentGet(S_FILE_INI));
+
+	INFO("Added and removed sections");
+	sut.SectionKeyValueSet("Section45a", "Key", 1);
+	REQUIRE(sut.INIFileSave(S_FILE_INI));
+	REQUIRE(sut.to_string() == FileContentGet(S_FILE_INI));
+	for (int Key = 10; Key < 30; ++Key)
+	{
+		sut.SectionKeyKill("Section59", "Key" + std::to_string(Key));
+	}
+	REQUIRE(sut.INIFileSave(S_FILE_INI));
+	REQUIRE(sut.to_string() == FileContentGet(S_FILE_INI));
+
+	INFO("Nothing changed");
+	REQUIRE(sut.INIFileSave(S_FILE_INI));
+	REQUIRE(sut.to_string() == FileContentGet(S_FILE_INI));
+
+#ifndef _WIN32
+	INFO("File modified by someone else within the same second and without a change of size");
+	std::string Content = FileContentGet(S_FILE_INI);
+	size_t Position = Content.find("Key10 = 100");
+	REQUIRE(std::string::npos != Position);
+	Content.replace(Position, 11, "Key10 = 101");
+	std::ofstream Rewritten(S_FILE_INI, std::ios::out | std::ios::trunc | std::ios::binary);
+	Rewritten << Content;
+	Rewritten.close();
+	sut.SectionKeyValueSet("Section40", "Key10", 401);
+	REQUIRE(sut.INIFileSave(S_FILE_INI));
+	REQUIRE(sut.to_string() == FileContentGet(S_FILE_INI));
+#endif
+
+	INFO("File modified by someone else is rewritten completely");
+	std::ofstream Foreign(S_FILE_INI, std::ios::app);
+	Foreign << "[Foreign]\nkey = value\n";
+	Foreign.close();
+	sut.SectionKeyValueSet("Section50", "Key10", 111);
+	REQUIRE(sut.INIFileSave(S_FILE_INI));
+	REQUIRE(sut.to_string() == FileContentGet(S_FILE_INI));
+
+	INFO("Other file is written completely");
+	const std::string OtherFile = "yaip_other.ini";
+	REQUIRE(sut.INIFileSave(OtherFile));
+	REQUIRE(sut.to_string() == FileContentGet(OtherFile));
+
+	net::derpaul::yaip::YAIP loaded;
+	REQUIRE(loaded.INIFileLoad(S_FILE_INI));
+	REQUIRE(sut.to_string() == loaded.to_string());
+
+	sut.INIFileDelete(OtherFile);
+	sut.INIFileDelete(S_FILE_INI);
+	REQUIRE(!sut.INIFileExist(S_FILE_INI));
+}
+
+TEST_CASE("Test view based lookup of YAIP", "[YAIP]")
+{
+	net::derpaul::yaip::YAIP sut;
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, S_KEY, std::string("stored value")));
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, S_KEY_INVALID, std::string("")));
+
+	const net::derpaul::yaip::YAIP &reader = sut;
+	net::derpaul::yaip::tStringView Value = reader.SectionKeyValueView("SECTION", "KEY", "default");
+	REQUIRE("stored value" == std::string(Value.data(), Value.length()));
+
+	INFO("Pointer and length, surrounding whitespaces are ignored");
+	const char *Buffer = " SECTION | KEY ";
+	Value = reader.SectionKeyValueView(net::derpaul::yaip::tStringView(Buffer, 9), net::derpaul::yaip::tStringView(Buffer + 10, 5), "default");
+	REQUIRE("stored value" == std::string(Value.data(), Value.length()));
+
+	INFO("Missing or empty values return the default");
+	Value = reader.SectionKeyValueView("SECTION", "MISSING", "default");
+	REQUIRE("default" == std::string(Value.data(), Value.length()));
+	Value = reader.SectionKeyValueView("MISSING", "KEY", "default");
+	REQUIRE("default" == std::string(Value.data(), Value.length()));
+	Value = reader.SectionKeyValueView("SECTION", "KEY_INVALID", "default");
+	REQUIRE("default" == std::string(Value.data(), Value.length()));
+}
+
+TEST_CASE("Test binary cache of YAIP", "[YAIP]")
+{
+	const std::string CacheFile = net::derpaul::yaip::IniCache::FilenameGet(S_FILE_INI);
+	net::derpaul::yaip::YAIP::INIFileDelete(CacheFile);
+
+	net::derpaul::yaip::YAIP sut;
+	for (int Section = 10; Section < 30; ++Section)
+	{
+		for (int Key = 10; Key < 30; ++Key)
+		{
+			sut.SectionKeyValueSet("Section" + std::to_string(Section), "Key" + std::to_string(Key), Section * Key);
+		}
+	}
+	REQUIRE(sut.INIFileSave(S_FILE_INI));
+
+	net::derpaul::yaip::YAIP loaded;
+	REQUIRE(!loaded.CacheEnabled());
+	loaded.CacheEnable(true);
+	REQUIRE(loaded.CacheEnabled());
+
+	INFO("Missing cache is written after parsing");
+	REQUIRE(loaded.INIFileLoad(S_FILE_INI));
+	REQUIRE(sut.to_string() == loaded.to_string());
+	REQUIRE(loaded.INIFileExist(CacheFile));
+
+	INFO("Valid cache is loaded instead of parsing");
+	REQUIRE(loaded.INIFileLoad(S_FILE_INI));
+	REQUIRE(sut.to_string() == loaded.to_string());
+	REQUIRE(std::string("400") == loaded.SectionKeyValueGet("Section20", "Key20", std::string("")));
+
+	loaded.ArenaEnable(true);
+	REQUIRE(loaded.INIFileLoad(S_FILE_INI));
+	REQUIRE(sut.to_string() == loaded.to_string());
+
+	INFO("Damaged cache is ignored and rewritten");
+	std::string Image = FileContentGet(CacheFile);
+	Image[Image.length() - 1] ^= 0x20;
+	std::ofstream Damaged(CacheFile, std::ios::out | std::ios::trunc | std::ios::binary);
+	Damaged << Image.substr(0, Image.length() / 2);
+	Damaged.close();
+	REQUIRE(loaded.INIFileLoad(S_FILE_INI));
+	REQUIRE(sut.to_string() == loaded.to_string());
+	REQUIRE(Image.length() == FileContentGet(CacheFile).length());
+
+	INFO("Image of the right size with a flipped bit is detected by the checksum");
+	std::ofstream Flipped(CacheFile, std::ios::out | std::ios::trunc | std::ios::binary);
+	Flipped << Image;
+	Flipped.close();
+	REQUIRE(loaded.INIFileLoad(S_FILE_INI));
+	REQUIRE(sut.to_string() == loaded.to_string());
+	REQUIRE(Image != FileContentGet(CacheFile));
+
+	INFO("Interned loads do not use the image");
+	loaded.InternEnable(true);
+	REQUIRE(loaded.INIFileLoad(S_FILE_INI));
+	REQUIRE(sut.to_string() == loaded.to_string());
+	REQUIRE(0 < loaded.StringPoolGet()->SizeGet());
+	loaded.InternEnable(false);
+
+	INFO("Touched INI file is loaded from the cache after comparing the hash");
+	const std::string Content = FileContentGet(S_FILE_INI);
+	std::ofstream Touched(S_FILE_INI, std::ios::out | std::ios::trunc | std::ios::binary);
+	Touched << Content;
+	Touched.close();
+	loaded.TraceEnable(true);
+	REQUIRE(loaded.INIFileLoad(S_FILE_INI));
+	REQUIRE(sut.to_string() == loaded.to_string());
+	bool Parsed = false;
+	for (auto const &Event : loaded.TraceGet()->EventsGet())
+	{
+		Parsed = Parsed || (std::string("ParseFileContent") == Event.Name);
+	}
+	REQUIRE(!Parsed);
+	loaded.TraceEnable(false);
+
+#ifndef _WIN32
+	INFO("Change without a change of size is detected by the time in nanoseconds");
+	std::string Changed = Content;
+	size_t Position = Changed.find("Key10 = 100");
+	REQUIRE(std::string::npos != Position);
+	Changed.replace(Position, 11, "Key10 = 101");
+	std::ofstream Rewritten(S_FILE_INI, std::ios::out | std::ios::trunc | std::ios::binary);
+	Rewritten << Changed;
+	Rewritten.close();
+	REQUIRE(loaded.INIFileLoad(S_FILE_INI));
+	REQUIRE(std::string("101") == loaded.SectionKeyValueGet("Section10", "Key10", std::string("")));
+	sut.SectionKeyValueSet("Section10", "Key10", 101);
+#endif
+
+	INFO("Modified INI file invalidates the cache");
+	sut.SectionKeyValueSet("Section15", "Key15", std::string("changed"));
+	REQUIRE(sut.INIFileSave(S_FILE_INI));
+	REQUIRE(loaded.INIFileLoad(S_FILE_INI));
+	REQUIRE(std::string("changed") == loaded.SectionKeyValueGet("Section15", "Key15", std::string("")));
+	REQUIRE(sut.to_string() == loaded.to_string());
+
+	sut.INIFileDelete(CacheFile);
+	sut.INIFileDelete(S_FILE_INI);
+	REQUIRE(!sut.INIFileExist(CacheFile));
+}
+
+TEST_CASE("Test typed value cache of YAIP", "[YAIP]")
+{
+	net::derpaul::yaip::YAIP sut;
+	REQUIRE(!sut.ValueCacheEnabled());
+	sut.ValueCacheEnable(true);
+	REQUIRE(sut.ValueCacheEnabled());
+
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, S_KEY, 1234));
+	for (int Loop = 0; Loop < 3; ++Loop)
+	{
+		REQUIRE(1234 == sut.SectionKeyValueGet(S_SECTION, S_KEY, 0));
+		REQUIRE(1234.0 == Approx(sut.SectionKeyValueGet(S_SECTION, S_KEY, 0.0)));
+		REQUIRE(-1 == sut.SectionKeyValueGet(S_SECTION, "missing", -1));
+		REQUIRE(-1 == sut.SectionKeyValueGet("missing", S_KEY, -1));
+	}
+
+	INFO("Set value is seen by the next typed read");
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, S_KEY, 5678));
+	REQUIRE(5678 == sut.SectionKeyValueGet(S_SECTION, S_KEY, 0));
+	REQUIRE(sut.SectionKeyValueClear(S_SECTION, S_KEY));
+	REQUIRE(-1 == sut.SectionKeyValueGet(S_SECTION, S_KEY, -1));
+}
+
+TEST_CASE("Test key handles of YAIP", "[YAIP]")
+{
+	net::derpaul::yaip::YAIP sut;
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, S_KEY, 10));
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, "other", std::string("other")));
+
+	net::derpaul::yaip::IniKeyHandle Handle = sut.KeyHandleGet(S_SECTION, S_KEY);
+	REQUIRE(Handle.Valid());
+	REQUIRE(10 == Handle.ValueGet(0));
+	REQUIRE(std::string("10") == Handle.ValueGet(std::string("")));
+
+	INFO("Missing keys give invalid handles");
+	net::derpaul::yaip::IniKeyHandle Missing = sut.KeyHandleGet(S_SECTION, "missing");
+	REQUIRE(!Missing.Valid());
+	REQUIRE(-1 == Missing.ValueGet(-1));
+	REQUIRE(!Missing.ValueSet(1));
+	REQUIRE(!sut.KeyHandleGet("missing", S_KEY).Valid());
+	REQUIRE(!net::derpaul::yaip::IniKeyHandle().Valid());
+
+	INFO("Set through handle is seen by YAIP and the other way round");
+	REQUIRE(Handle.ValueSet(20));
+	REQUIRE(20 == sut.SectionKeyValueGet(S_SECTION, S_KEY, 0));
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, S_KEY, 30));
+	REQUIRE(30 == Handle.ValueGet(0));
+
+	INFO("Unrelated inserts and deletes keep the handle valid");
+	for (int Key = 0; Key < 100; ++Key)
+	{
+		sut.SectionKeyValueSet(S_SECTION, "Key" + std::to_string(Key), Key);
+		sut.SectionKeyValueSet("Section" + std::to_string(Key), S_KEY, Key);
+	}
+	REQUIRE(sut.SectionKeyKill(S_SECTION, "other"));
+	REQUIRE(Handle.Valid());
+	REQUIRE(30 == Handle.ValueGet(0));
+
+	INFO("Killed key invalidates the handle");
+	REQUIRE(sut.SectionKeyKill(S_SECTION, S_KEY));
+	REQUIRE(!Handle.Valid());
+	REQUIRE(-1 == Handle.ValueGet(-1));
+	REQUIRE(!Handle.ValueSet(40));
+	REQUIRE(-1 == sut.SectionKeyValueGet(S_SECTION, S_KEY, -1));
+
+	INFO("Clear invalidates the handle");
+	Handle = sut.KeyHandleGet("Section5", S_KEY);
+	REQUIRE(5 == Handle.ValueGet(0));
+	sut.Clear();
+	REQUIRE(!Handle.Valid());
+
+	INFO("Removed keys invalidate the handle even if their entry is still referenced");
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, S_KEY, 60));
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, "other", 70));
+	Handle = sut.KeyHandleGet(S_SECTION, S_KEY);
+	net::derpaul::yaip::IniKeyHandle Other = sut.KeyHandleGet(S_SECTION, "other");
+	net::derpaul::yaip::IniEntryPtr Referenced = sut.SectionListView().ElementFind(S_SECTION)->EntryFind(S_KEY);
+	REQUIRE(sut.SectionKeyKill(S_SECTION, S_KEY));
+	REQUIRE(!Handle.Valid());
+	REQUIRE(!Handle.ValueSet(80));
+	REQUIRE("60" == Referenced->ElementValueGet());
+	Referenced = sut.SectionListView().ElementFind(S_SECTION)->EntryFind("other");
+	net::derpaul::yaip::IniTransaction Transaction = sut.TransactionBegin();
+	Transaction.SectionKeyKill(S_SECTION, "other");
+	REQUIRE(Transaction.Commit());
+	REQUIRE(!Other.Valid());
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, S_KEY, 90));
+	Handle = sut.KeyHandleGet(S_SECTION, S_KEY);
+	Referenced = sut.SectionListView().ElementFind(S_SECTION)->EntryFind(S_KEY);
+	sut.Clear();
+	REQUIRE(!Handle.Valid());
+	Referenced.reset();
+
+	INFO("A handle does not keep the arena of a removed key alive");
+	sut.ArenaEnable(true);
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, S_KEY, 50));
+	Handle = sut.KeyHandleGet(S_SECTION, S_KEY);
+	REQUIRE(50 == Handle.ValueGet(0));
+	std::weak_ptr<net::derpaul::yaip::IniMemoryResource> Arena = sut.MemoryResourceGet();
+	sut.Clear();
+	REQUIRE(!Handle.Valid());
+	REQUIRE(Arena.expired());
+}
+
+struct SchemaTestConfig
+{
+	bool Enabled;
+	double Ratio;
+	std::string Host;
+	int Port;
+	unsigned short Retries;
+};
+
+TEST_CASE("Test schema binding of YAIP", "[YAIP]")
+{
+	using net::derpaul::yaip::IniSchemaFieldMake;
+	static const auto Schema = net::derpaul::yaip::IniSchemaMake(
+		IniSchemaFieldMake("Server", "enabled", &SchemaTestConfig::Enabled, false),
+		IniSchemaFieldMake("Server", "ratio", &SchemaTestConfig::Ratio, 0.5),
+		IniSchemaFieldMake("Server", "host", &SchemaTestConfig::Host, std::string("localhost")),
+		IniSchemaFieldMake("Server", "port", &SchemaTestConfig::Port, 80),
+		IniSchemaFieldMake("Client", "retries", &SchemaTestConfig::Retries, 3));
+	REQUIRE(5 == Schema.FieldCountGet());
+
+	INFO("Defaults for missing keys");
+	net::derpaul::yaip::YAIP sut;
+	SchemaTestConfig Config;
+	sut.SchemaLoad(Schema, Config);
+	REQUIRE(!Config.Enabled);
+	REQUIRE(0.5 == Approx(Config.Ratio));
+	REQUIRE(std::string("localhost") == Config.Host);
+	REQUIRE(80 == Config.Port);
+	REQUIRE(3 == Config.Retries);
+
+	INFO("Values of existing keys");
+	REQUIRE(sut.SectionKeyValueSet("Server", "enabled", true));
+	REQUIRE(sut.SectionKeyValueSet("Server", "host", std::string("example.org")));
+	REQUIRE(sut.SectionKeyValueSet("Server", "port", 8080));
+	sut.SchemaLoad(Schema, Config);
+	REQUIRE(Config.Enabled);
+	REQUIRE(std::string("example.org") == Config.Host);
+	REQUIRE(8080 == Config.Port);
+	REQUIRE(3 == Config.Retries);
+
+	INFO("Struct is written back");
+	Config.Ratio = 0.25;
+	Config.Retries = 7;
+	sut.SchemaSave(Schema, Config);
+	REQUIRE(0.25 == Approx(sut.SectionKeyValueGet("Server", "ratio", 0.0)));
+	REQUIRE(7 == sut.SectionKeyValueGet("Client", "retries", 0));
+	REQUIRE(sut.INIFileSave(S_FILE_INI));
+
+	INFO("Bound struct is filled on load");
+	net::derpaul::yaip::YAIP loaded;
+	SchemaTestConfig Bound;
+	loaded.SchemaBind(Schema, Bound);
+	REQUIRE(80 == Bound.Port);
+	REQUIRE(loaded.INIFileLoad(S_FILE_INI));
+	REQUIRE(8080 == Bound.Port);
+	REQUIRE(7 == Bound.Retries);
+	REQUIRE(0.25 == Approx(Bound.Ratio));
+	REQUIRE(std::string("example.org") == Bound.Host);
+
+	INFO("Unbound struct is left alone");
+	loaded.SchemaUnbind();
+	Bound.Port = 1;
+	REQUIRE(loaded.INIFileLoad(S_FILE_INI));
+	REQUIRE(1 == Bound.Port);
+
+	sut.INIFileDelete(S_FILE_INI);
+}
+
+TEST_CASE("Test transactions of YAIP", "[YAIP]")
+{
+	net::derpaul::yaip::YAIP sut;
+	REQUIRE(sut.SectionKeyValueSet("First", "a", 1));
+	REQUIRE(sut.SectionKeyValueSet("First", "b", 2));
+	REQUIRE(sut.SectionKeyValueSet("First", "c", 3));
+	REQUIRE(sut.SectionKeyValueSet("Second", "x", 1));
+	const std::string Before = sut.to_string();
+
+	net::derpaul::yaip::IniTransaction Transaction = sut.TransactionBegin();
+	REQUIRE(Transaction.IsEmpty());
+	Transaction.SectionKeyValueSet("First", "a", 10);
+	Transaction.SectionKeyKill("First", "c");
+	Transaction.SectionKeyValueSet("Third", "new", std::string("value"));
+	Transaction.SectionKeyValueSet("First", "d", 4);
+	Transaction.SectionKeyKill("Second", "x");
+	Transaction.SectionKeyValueSet(" First ", " a ", 11);
+	REQUIRE(5 == Transaction.SizeGet());
+
+	INFO("Nothing is applied before commit");
+	REQUIRE(Before == sut.to_string());
+
+	INFO("Commit applies all changes");
+	REQUIRE(Transaction.Commit());
+	REQUIRE(Transaction.IsEmpty());
+	REQUIRE(11 == sut.SectionKeyValueGet("First", "a", 0));
+	REQUIRE(2 == sut.SectionKeyValueGet("First", "b", 0));
+	REQUIRE(-1 == sut.SectionKeyValueGet("First", "c", -1));
+	REQUIRE(4 == sut.SectionKeyValueGet("First", "d", 0));
+	REQUIRE(std::string("value") == sut.SectionKeyValueGet("Third", "new", std::string("")));
+	REQUIRE(2 == sut.SectionListGet().size());
+	REQUIRE(std::string("a") == sut.SectionKeyListGet("First").front());
+	REQUIRE(3 == sut.SectionKeyListGet("First").size());
+
+	INFO("Discard drops all changes");
+	const std::string After = sut.to_string();
+	Transaction.SectionKeyValueSet("First", "a", 12);
+	Transaction.SectionKeyKill("Third", "new");
+	Transaction.Discard();
+	REQUIRE(Transaction.IsEmpty());
+	REQUIRE(Transaction.Commit());
+	REQUIRE(After == sut.to_string());
+
+	INFO("Invalid change rejects the whole transaction");
+	Transaction.SectionKeyValueSet("First", "a", 13);
+	Transaction.SectionKeyValueSet("First", " ", 14);
+	REQUIRE(!Transaction.Commit());
+	REQUIRE(After == sut.to_string());
+	Transaction.Discard();
+
+	INFO("Later change of a key replaces the earlier one");
+	Transaction.SectionKeyKill("First", "b");
+	Transaction.SectionKeyValueSet("First", "b", 20);
+	Transaction.SectionKeyValueSet("Fourth", "k", 1);
+	Transaction.SectionKeyKill("Fourth", "k");
+	REQUIRE(Transaction.Commit());
+	REQUIRE(20 == sut.SectionKeyValueGet("First", "b", 0));
+	REQUIRE(2 == sut.SectionListGet().size());
+
+	INFO("Commit counts sets and deletes like single calls");
+	const bool Counted = net::derpaul::yaip::YAIP::StatsEnabled();
+	sut.StatsReset();
+	Transaction.SectionKeyValueSet("First", "a", 30);
+	Transaction.SectionKeyValueSet("Fifth", "e", 5);
+	Transaction.SectionKeyKill("First", "d");
+	Transaction.SectionKeyKill("First", "missing");
+	REQUIRE(Transaction.Commit());
+	net::derpaul::yaip::IniStatsSnapshot Stats = sut.StatsGet();
+	REQUIRE((Counted ? 2u : 0u) == Stats.Sets);
+	REQUIRE((Counted ? 1u : 0u) == Stats.Deletes);
+}
+
+TEST_CASE("Test update in place of YAIP", "[YAIP]")
+{
+	net::derpaul::yaip::YAIP sut;
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, "first", 1));
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, "second", 2));
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, "third", 3));
+	net::derpaul::yaip::IniKeyHandle Handle = sut.KeyHandleGet(S_SECTION, "first");
+
+	INFO("Updated key keeps its position");
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, "first", std::string("  updated  ")));
+	net::derpaul::yaip::tListString Keys = sut.SectionKeyListGet(S_SECTION);
+	REQUIRE(3 == Keys.size());
+	REQUIRE(std::string("first") == Keys.front());
+	REQUIRE(std::string("third") == Keys.back());
+	REQUIRE(std::string("updated") == sut.SectionKeyValueGet(S_SECTION, "first", std::string("")));
+
+	INFO("Same entry is updated");
+	REQUIRE(Handle.Valid());
+	REQUIRE(std::string("updated") == Handle.ValueGet(std::string("")));
+
+	INFO("New keys are appended");
+	REQUIRE(sut.SectionKeyValueSet(S_SECTION, "fourth", 4));
+	REQUIRE(std::string("fourth") == sut.SectionKeyListGet(S_SECTION).back());
+}
+
+TEST_CASE("Test views of sections and entries of YAIP", "[YAIP]")
+{
+	net::derpaul::yaip::YAIP sut;
+	REQUIRE(sut.SectionListView().begin() == sut.SectionListView().end());
+	for (int Section = 0; Section < 10; ++Section)
+	{
+		for (int Key = 0; Key < 20; ++Key)
+		{
+			sut.SectionKeyValueSet("Section" + std::to_string(Section), "Key" + std::to_string(Key), Section * Key);
+		}
+	}
+
+	INFO("Views visit the same elements as the copying lists");
+	net::derpaul::yaip::tListString Sections = sut.SectionListGet();
+	auto Name = Sections.begin();
+	size_t Entries = 0;
+	for (auto const &Section : sut.SectionListView())
+	{
+		REQUIRE(*Name++ == Section->ElementIdentifierGet());
+		net::derpaul::yaip::tListString Keys = sut.SectionKeyListGet(Section->ElementIdentifierGet());
+		auto Key = Keys.begin();
+		for (auto const &Entry : sut.SectionEntriesView(Section->ElementIdentifierGet()))
+		{
+			REQUIRE(*Key++ == Entry->ElementIdentifierGet());
+			REQUIRE(sut.SectionKeyValueGet(Section->ElementIdentifierGet(), Entry->ElementIdentifierGet(), std::string("")) == Entry->ElementValueGet());
+			++Entries;
+		}
+	}
+	REQUIRE(Sections.end() == Name);
+	REQUIRE(200 == Entries);
+
+	INFO("Values are references to the stored data");
+	const net::derpaul::yaip::IniString &Value = sut.SectionEntriesView("Section3").begin()->get()->ElementValueGet();
+	REQUIRE(sut.SectionKeyValueSet("Section3", "Key0", std::string("changed")));
+	REQUIRE(std::string("changed") == Value);
+
+	INFO("Missing section gives an empty view");
+	REQUIRE(sut.SectionEntriesView("missing").begin() == sut.SectionEntriesView("missing").end());
+
+	INFO("Snapshots offer views of values only");
+	net::derpaul::yaip::IniSnapshotPtr Snapshot = sut.SnapshotPublish();
+	REQUIRE(10 == Snapshot->SectionListGet().size());
+	REQUIRE(20 == Snapshot->SectionKeyListGet("Section3").size());
+	net::derpaul::yaip::tStringView Snapshotted = Snapshot->SectionKeyValueView("Section3", "Key2", "");
+	REQUIRE(std::string("6") == std::string(Snapshotted.data(), Snapshotted.length()));
+}
+
+TEST_CASE("Test layers of YAIP", "[YAIP]")
+{
+	const std::string Defaults = "yaip_defaults.ini";
+	const std::string Host = "yaip_host.ini";
+	{
+		std::ofstream IniFile(Defaults);
+		IniFile << "[Server]\nhost = localhost\nport = 80\ntimeout = 30\n[Client]\nretries = 3\n";
+	}
+	{
+		std::ofstream IniFile(Host);
+		IniFile << "[Server]\nport = 8080\nempty =\n[Host]\nname = box\n";
+	}
+
+	net::derpaul::yaip::IniLayers sut;
+	REQUIRE(0 == sut.LayerAdd());
+	REQUIRE(1 == sut.LayerAdd());
+	REQUIRE(2 == sut.LayerAdd());
+	REQUIRE(3 == sut.LayerCountGet());
+	REQUIRE(sut.LayerLoad(0, Defaults));
+	REQUIRE(sut.LayerLoad(2, Host));
+	REQUIRE(!sut.LayerLoad(3, Host));
+
+	INFO("Highest layer with a value wins");
+	REQUIRE(5 == sut.SizeGet());
+	REQUIRE(8080 == sut.SectionKeyValueGet("Server", "port", 0));
+	REQUIRE(2 == sut.SectionKeyLayerGet("Server", "port"));
+	REQUIRE(std::string("localhost") == sut.SectionKeyValueGet("Server", "host", std::string("")));
+	REQUIRE(0 == sut.SectionKeyLayerGet(" Server ", " host "));
+	REQUIRE(std::string("box") == sut.SectionKeyValueGet("Host", "name", std::string("")));
+	REQUIRE(std::string::npos == sut.SectionKeyLayerGet("Server", "empty"));
+	REQUIRE(std::string("none") == sut.SectionKeyValueGet("Server", "empty", std::string("none")));
+	net::derpaul::yaip::tStringView View = sut.SectionKeyValueView("Client", "retries", "");
+	REQUIRE(std::string("3") == std::string(View.data(), View.length()));
+
+	INFO("Set in a middle layer");
+	REQUIRE(sut.SectionKeyValueSet(1, "Server", "timeout", 60));
+	REQUIRE(sut.SectionKeyValueSet(1, "Server", "port", 1234));
+	REQUIRE(60 == sut.SectionKeyValueGet("Server", "timeout", 0));
+	REQUIRE(8080 == sut.SectionKeyValueGet("Server", "port", 0));
+	REQUIRE(!sut.SectionKeyValueSet(3, "Server", "port", 1));
+
+	INFO("Killed key falls back to lower layers");
+	REQUIRE(sut.SectionKeyKill(2, "Server", "port"));
+	REQUIRE(1234 == sut.SectionKeyValueGet("Server", "port", 0));
+	REQUIRE(sut.SectionKeyKill(1, "Server", "port"));
+	REQUIRE(80 == sut.SectionKeyValueGet("Server", "port", 0));
+	REQUIRE(sut.SectionKeyKill(0, "Server", "port"));
+	REQUIRE(-1 == sut.SectionKeyValueGet("Server", "port", -1));
+
+	INFO("Reloading a layer updates only its keys");
+	{
+		std::ofstream IniFile(Host);
+		IniFile << "[Server]\nport = 9090\n[Client]\nretries = 5\n";
+	}
+	REQUIRE(sut.LayerLoad(2, Host));
+	REQUIRE(9090 == sut.SectionKeyValueGet("Server", "port", 0));
+	REQUIRE(5 == sut.SectionKeyValueGet("Client", "retries", 0));
+	REQUIRE(-1 == sut.SectionKeyValueGet("Host", "name", -1));
+	REQUIRE(60 == sut.SectionKeyValueGet("Server", "timeout", 0));
+	REQUIRE(std::string("localhost") == sut.SectionKeyValueGet("Server", "host", std::string("")));
+
+	INFO("Any modification through LayerUpdate");
+	REQUIRE(sut.LayerUpdate(2, [](net::derpaul::yaip::YAIP &Layer) { Layer.Clear(); return true; }));
+	REQUIRE(3 == sut.SectionKeyValueGet("Client", "retries", 0));
+	REQUIRE(-1 == sut.SectionKeyValueGet("Server", "port", -1));
+	REQUIRE(3 == sut.SizeGet());
+	REQUIRE(0 == sut.LayerGet(2).SectionListView().size());
+
+	net::derpaul::yaip::YAIP::INIFileDelete(Defaults);
+	net::derpaul::yaip::YAIP::INIFileDelete(Host);
+}
+
+TEST_CASE("Test statistics of YAIP", "[YAIP]")
+{
+	const std::string Filename = "yaip_stats.ini";
+	{
+		std::ofstream IniFile(Filename);
+		IniFile << "[Server]\nhost = localhost\nport = 80\n";
+	}
+
+	net::derpaul::yaip::YAIP sut;
+	REQUIRE(sut.INIFileLoad(Filename));
+	REQUIRE(80 == sut.SectionKeyValueGet("Server", "port", 0));
+	REQUIRE(std::string("localhost") == sut.SectionKeyValueGet("Server", "host", std::string("")));
+	REQUIRE(std::string("none") == sut.SectionKeyValueGet("Server", "user", std::string("none")));
+	REQUIRE(-1 == sut.SectionKeyValueGet("Client", "retries", -1));
+	REQUIRE(sut.SectionKeyValueSet("Client", "retries", 3));
+	REQUIRE(sut.SectionKeyKill("Server", "host"));
+	REQUIRE(sut.INIFileSave(Filename));
+
+	net::derpaul::yaip::IniStatsSnapshot Stats = sut.StatsGet();
+	if (!net::derpaul::yaip::YAIP::StatsEnabled())
+	{
+		INFO("Without YAIP_STATS nothing is counted");
+		REQUIRE(0 == Stats.Lookups);
+		REQUIRE(0 == Stats.GetLatency.Count);
+	}
+	else
+	{
+		INFO("Counters");
+		REQUIRE(4 == Stats.Lookups);
+		REQUIRE(2 == Stats.LookupHits);
+		REQUIRE(2 == Stats.LookupMisses);
+		REQUIRE(1 == Stats.Sets);
+		REQUIRE(1 == Stats.Deletes);
+		REQUIRE(2 == Stats.Conversions);
+		REQUIRE(0 == Stats.ConversionFailures);
+
+		INFO("Histograms");
+		REQUIRE(4 == Stats.GetLatency.Count);
+		REQUIRE(1 == Stats.SetLatency.Count);
+		REQUIRE(1 == Stats.LoadDuration.Count);
+		REQUIRE(1 == Stats.ParseDuration.Count);
+		REQUIRE(1 == Stats.SaveDuration.Count);
+		uint64_t Buckets = 0;
+		for (size_t Bucket = 0; Bucket < net::derpaul::yaip::IniStatsHistogram::BucketCount; ++Bucket)
+		{
+			Buckets += Stats.GetLatency.Buckets[Bucket];
+		}
+		REQUIRE(4 == Buckets);
+		REQUIRE(Stats.GetLatency.MaxNanoseconds <= Stats.GetLatency.TotalNanoseconds);
+		REQUIRE(Stats.LoadDuration.TotalNanoseconds >= Stats.ParseDuration.TotalNanoseconds);
+
+		INFO("Reset");
+		sut.StatsReset();
+		Stats = sut.StatsGet();
+		REQUIRE(0 == Stats.Lookups);
+		REQUIRE(0 == Stats.SaveDuration.Count);
+	}
+
+	INFO("Percentiles are the upper bound of a bucket");
+	net::derpaul::yaip::IniStatsHistogram Histogram;
+	REQUIRE(0 == Histogram.PercentileGet(50.0));
+	Histogram.Count = 4;
+	Histogram.Buckets[3] = 3;
+	Histogram.Buckets[10] = 1;
+	Histogram.MaxNanoseconds = 1500;
+	REQUIRE(16 == Histogram.PercentileGet(50.0));
+	REQUIRE(16 == Histogram.PercentileGet(75.0));
+	REQUIRE(1500 == Histogram.PercentileGet(99.0));
+
+	net::derpaul::yaip::YAIP::INIFileDelete(Filename);
+}
+
+TEST_CASE("Test tracing of YAIP", "[YAIP]")
+{
+	const std::string Filename = "yaip_trace.ini";
+	const std::string TraceFile = "yaip_trace.json";
+	{
+		std::ofstream IniFile(Filename);
+		IniFile << "[Server]\nport = 80\n; comment\nhost = localhost\n";
+	}
+
+	net::derpaul::yaip::YAIP sut;
+	REQUIRE(!sut.TraceEnabled());
+	REQUIRE(nullptr == sut.TraceGet());
+
+	sut.TraceEnable(true);
+	REQUIRE(sut.TraceEnabled());
+	REQUIRE(sut.INIFileLoad(Filename));
+	REQUIRE(sut.INIFileSave(Filename));
+
+	INFO("Spans are recorded when they end");
+	auto Events = sut.TraceGet()->EventsGet();
+	std::vector<std::string> Names;
+	for (auto const &Event : Events)
+	{
+		Names.push_back(Event.Name);
+	}
+	std::vector<std::string> Expected = { "Clear", "FileRead", "ParseFileContent", "INIFileLoad", "sort", "Write", "INIFileSave" };
+	REQUIRE(Expected == Names);
+
+	INFO("Parsing reports its steps");
+	const net::derpaul::yaip::IniTraceEvent &Parse = Events[2];
+	REQUIRE(4 == Parse.ArgCount);
+	REQUIRE(std::string("lines") == Parse.Args[0].Name);
+	REQUIRE(4 == Parse.Args[0].Value);
+	REQUIRE(Parse.Duration <= Events[3].Duration);
+
+	INFO("Export");
+	REQUIRE(sut.TraceGet()->ChromeJsonSave(TraceFile));
+	REQUIRE(net::derpaul::yaip::YAIP::INIFileExist(TraceFile));
+
+	sut.TraceEnable(false);
+	REQUIRE(nullptr == sut.TraceGet());
+
+	net::derpaul::yaip::YAIP::INIFileDelete(Filename);
+	net::derpaul::yaip::YAIP::INIFileDelete(TraceFile);
+}
+
 #endif // _TEST_YAIP_H_
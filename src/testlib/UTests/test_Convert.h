@@ -240,4 +240,64 @@ SCENARIO("Test class Convert", "[Convert]")
 	test_bool();
 }
 
+template <typename T>
+void test_roundtrip(const std::string &dataType)
+{
+	INFO("Test round trip of [" + dataType + "]");
+	std::string value_string;
+	T values[] = { std::numeric_limits<T>::lowest(), std::numeric_limits<T>::min(), std::numeric_limits<T>::max(), static_cast<T>(42) };
+
+	for (auto const &value_numeric : values)
+	{
+		T value_read = static_cast<T>(0);
+		REQUIRE(net::derpaul::yaip::Convert::ConvertTo(value_numeric, value_string));
+		REQUIRE(net::derpaul::yaip::Convert::ConvertTo(value_string, value_read));
+		REQUIRE(value_numeric == value_read);
+	}
+}
+
+SCENARIO("Test round trips of class Convert", "[Convert]")
+{
+	test_roundtrip<int>("int");
+	test_roundtrip<unsigned int>("unsigned int");
+	test_roundtrip<short>("short");
+	test_roundtrip<unsigned short>("unsigned short");
+	test_roundtrip<long>("long");
+	test_roundtrip<unsigned long>("unsigned long");
+	test_roundtrip<float>("float");
+	test_roundtrip<double>("double");
+
+	INFO("Formats used by both converters");
+	std::string value_string;
+	net::derpaul::yaip::Convert::ConvertTo(123456789, value_string);
+	REQUIRE("123456789" == value_string);
+	net::derpaul::yaip::Convert::ConvertTo(0.1, value_string);
+	REQUIRE("1.00000000000000006e-01" == value_string);
+	net::derpaul::yaip::Convert::ConvertTo(-0.1f, value_string);
+	REQUIRE("-1.000000015e-01" == value_string);
+	net::derpaul::yaip::Convert::ConvertTo(std::numeric_limits<double>::infinity(), value_string);
+	REQUIRE("inf" == value_string);
+
+	INFO("Leading whitespaces and plus sign are accepted");
+	int value_int = 0;
+	REQUIRE(net::derpaul::yaip::Convert::ConvertTo(std::string(" +17"), value_int));
+	REQUIRE(17 == value_int);
+	unsigned int value_uint = 0;
+	REQUIRE(net::derpaul::yaip::Convert::ConvertTo(std::string("-1"), value_uint));
+	REQUIRE(std::numeric_limits<unsigned int>::max() == value_uint);
+
+#ifdef YAIP_CHARCONV
+	INFO("Invalid input is reported, value stays unchanged");
+	value_int = 5;
+	REQUIRE(!net::derpaul::yaip::Convert::ConvertTo(std::string("abc"), value_int));
+	REQUIRE(!net::derpaul::yaip::Convert::ConvertTo(std::string("+-1"), value_int));
+	REQUIRE(!net::derpaul::yaip::Convert::ConvertTo(std::string("99999999999999999999"), value_int));
+	REQUIRE(5 == value_int);
+	double value_double = 1.5;
+	REQUIRE(!net::derpaul::yaip::Convert::ConvertTo(std::string(""), value_double));
+	REQUIRE(!net::derpaul::yaip::Convert::ConvertTo(std::string("1e999"), value_double));
+	REQUIRE(1.5 == value_double);
+#endif
+}
+
 #endif // _TEST_CONVERT_H_
\ No newline at end of file
@@ -0,0 +1,65 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+#ifndef _TEST_INIARENA_H_
+#define _TEST_INIARENA_H_
+
+#include "catch2/catch.hpp"
+#include "IniArena.h"
+#include "IniSection.h"
+#include <cstdint>
+
+SCENARIO("Test class IniArena", "[IniArena]")
+{
+	net::derpaul::yaip::IniArenaPtr sut = std::make_shared<net::derpaul::yaip::IniArena>(1024);
+	REQUIRE(0 == sut->BlockCount());
+
+	INFO("Allocations are aligned and share a block");
+	void *First = sut->Allocate(3, 1);
+	void *Second = sut->Allocate(8, 8);
+	REQUIRE(1 == sut->BlockCount());
+	REQUIRE(0 == (reinterpret_cast<uintptr_t>(Second) % 8));
+	REQUIRE(static_cast<char *>(Second) > static_cast<char *>(First));
+
+	INFO("Oversized allocations get a block of their own");
+	void *Large = sut->Allocate(4096, 16);
+	REQUIRE(2 == sut->BlockCount());
+	REQUIRE(0 == (reinterpret_cast<uintptr_t>(Large) % 16));
+	void *Third = sut->Allocate(8, 8);
+	REQUIRE(2 == sut->BlockCount());
+	REQUIRE(static_cast<char *>(Third) > static_cast<char *>(Second));
+
+	INFO("Elements keep the arena alive");
+	net::derpaul::yaip::IniSectionPtr Section = std::allocate_shared<net::derpaul::yaip::IniSection>(net::derpaul::yaip::IniAllocator<net::derpaul::yaip::IniSection>(sut));
+	net::derpaul::yaip::IniEntryPtr Entry = std::allocate_shared<net::derpaul::yaip::IniEntry>(net::derpaul::yaip::IniAllocator<net::derpaul::yaip::IniEntry>(sut));
+	Entry->ElementIdentifierSet("key");
+	Entry->ElementValueSet("a value which is too long for the small string optimization");
+	Section->EntryAdd(Entry);
+
+	std::weak_ptr<net::derpaul::yaip::IniArena> Observer = sut;
+	sut.reset();
+	REQUIRE(!Observer.expired());
+	REQUIRE(Entry == Section->EntryFind("key"));
+
+	Section.reset();
+	Entry.reset();
+	REQUIRE(Observer.expired());
+}
+
+#endif // _TEST_INIARENA_H_
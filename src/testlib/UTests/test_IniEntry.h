@@ -72,4 +72,34 @@ SCENARIO("Test class IniEntry", "[IniEntry]")
 	REQUIRE(RawData == sut.to_string());
 }
 
+SCENARIO("Test typed value cache of class IniEntry", "[IniEntry]")
+{
+	net::derpaul::yaip::IniEntry sut;
+	sut.ElementValueSet("42");
+
+	INFO("First and repeated conversion");
+	int ValueInt = 0;
+	REQUIRE(sut.ElementValueConvert(ValueInt));
+	REQUIRE(42 == ValueInt);
+	ValueInt = 0;
+	REQUIRE(sut.ElementValueConvert(ValueInt));
+	REQUIRE(42 == ValueInt);
+
+	INFO("Other type is converted anew");
+	double ValueDouble = 0.0;
+	REQUIRE(sut.ElementValueConvert(ValueDouble));
+	REQUIRE(42.0 == Approx(ValueDouble));
+	short ValueShort = 0;
+	REQUIRE(sut.ElementValueConvert(ValueShort));
+	REQUIRE(42 == ValueShort);
+
+	INFO("Changed value invalidates the cache");
+	sut.ElementValueSet("7");
+	REQUIRE(sut.ElementValueConvert(ValueShort));
+	REQUIRE(7 == ValueShort);
+	REQUIRE(sut.CreateFromRawData("key = 8"));
+	REQUIRE(sut.ElementValueConvert(ValueShort));
+	REQUIRE(8 == ValueShort);
+}
+
 #endif // _TEST_INIENTRY_H_
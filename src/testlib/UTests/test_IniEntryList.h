@@ -67,4 +67,54 @@ SCENARIO("Test class IniEntryList", "[IniEntryList]")
 	REQUIRE(0 == size);
 }
 
+SCENARIO("Test hash index of IniEntryList", "[IniEntryList]")
+{
+	net::derpaul::yaip::IniEntryList sut;
+	REQUIRE(sut.IndexEnabled());
+
+	for (int Loop = 0; Loop < 100; ++Loop)
+	{
+		net::derpaul::yaip::IniEntryPtr entry(new net::derpaul::yaip::IniEntry);
+		entry->ElementIdentifierSet("key" + std::to_string(Loop));
+		entry->ElementValueSet("value" + std::to_string(Loop));
+		sut.ElementAdd(entry);
+	}
+
+	INFO("Duplicate key, first one wins like the linear search");
+	net::derpaul::yaip::IniEntryPtr duplicate(new net::derpaul::yaip::IniEntry);
+	duplicate->ElementIdentifierSet("key42");
+	duplicate->ElementValueSet("duplicate");
+	sut.ElementAdd(duplicate);
+
+	for (int Loop = 0; Loop < 2; ++Loop)
+	{
+		auto result = sut.ElementFind("  key42\t");
+		REQUIRE(nullptr != result);
+		REQUIRE("value42" == result->ElementValueGet());
+		REQUIRE(nullptr == sut.ElementFind("key100"));
+		REQUIRE(nullptr == sut.ElementFind(""));
+
+		INFO("Same results with linear search");
+		sut.IndexEnable(false);
+		REQUIRE(!sut.IndexEnabled());
+	}
+	sut.IndexEnable(true);
+
+	INFO("Delete removes all entries of an identifier");
+	sut.ElementDelete(duplicate);
+	REQUIRE(99 == sut.size());
+	REQUIRE(nullptr == sut.ElementFind("key42"));
+	REQUIRE(nullptr != sut.ElementFind("key41"));
+
+	INFO("Rename requires rebuild of the index");
+	auto renamed = sut.ElementFind("key7");
+	renamed->ElementIdentifierSet("renamed");
+	sut.IndexRebuild();
+	REQUIRE(renamed == sut.ElementFind("renamed"));
+	REQUIRE(nullptr == sut.ElementFind("key7"));
+
+	sut.clear();
+	REQUIRE(nullptr == sut.ElementFind("key1"));
+}
+
 #endif // _TEST_INIENTRYLIST_H_
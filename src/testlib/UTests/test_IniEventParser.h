@@ -0,0 +1,112 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+#ifndef _TEST_INIEVENTPARSER_H_
+#define _TEST_INIEVENTPARSER_H_
+
+#include "catch2/catch.hpp"
+#include "IniEventParser.h"
+#include <sstream>
+#include <string>
+#include <vector>
+
+class IniEventRecorder : public net::derpaul::yaip::IIniEventHandler
+{
+public:
+	std::vector<std::string> Events;
+	size_t StopAfter = 0;
+
+	virtual bool OnComment(const net::derpaul::yaip::IniToken &Comment) override
+	{
+		Events.push_back("C:" + Comment.to_string());
+		return Continue();
+	}
+
+	virtual bool OnEntry(const std::string &Section, const net::derpaul::yaip::IniLine &Line) override
+	{
+		Events.push_back("E:" + Section + "/" + Line.Identifier.to_string() + "=" + Line.Value.to_string());
+		return Continue();
+	}
+
+	virtual bool OnSection(const net::derpaul::yaip::IniLine &Line) override
+	{
+		Events.push_back("S:" + Line.Identifier.to_string());
+		return Continue();
+	}
+
+private:
+	bool Continue(void) const
+	{
+		return (0 == StopAfter) || (Events.size() < StopAfter);
+	}
+};
+
+SCENARIO("Test class IniEventParser", "[IniEventParser]")
+{
+	const std::string Content =
+		"orphan = skipped\n"
+		"; first comment\r\n"
+		"[Section1] ; section comment\n"
+		"key1 = value1\n"
+		"\n"
+		"invalid line\n"
+		"key2 = a value which is longer than a chunk ; comment\n"
+		"[Section2]\n"
+		"key3 = value3";
+
+	const std::vector<std::string> Expected = {
+		"C:first comment",
+		"S:Section1",
+		"E:Section1/key1=value1",
+		"E:Section1/key2=a value which is longer than a chunk",
+		"S:Section2",
+		"E:Section2/key3=value3"
+	};
+
+	INFO("Data in memory");
+	IniEventRecorder Memory;
+	net::derpaul::yaip::IniEventParser MemoryParser(Memory);
+	REQUIRE(MemoryParser.ParseData(Content.data(), Content.length()));
+	REQUIRE(Expected == Memory.Events);
+	REQUIRE(9 == MemoryParser.LineNumberGet());
+
+	INFO("Stream read in chunks smaller than a line");
+	IniEventRecorder Chunked;
+	net::derpaul::yaip::IniEventParser ChunkedParser(Chunked, 8);
+	std::istringstream Stream(Content);
+	REQUIRE(ChunkedParser.ParseStream(Stream));
+	REQUIRE(Expected == Chunked.Events);
+
+	INFO("Handler stops parsing");
+	IniEventRecorder Stopped;
+	Stopped.StopAfter = 3;
+	net::derpaul::yaip::IniEventParser StoppedParser(Stopped, 8);
+	std::istringstream StoppedStream(Content);
+	REQUIRE(!StoppedParser.ParseStream(StoppedStream));
+	REQUIRE(3 == Stopped.Events.size());
+	REQUIRE(4 == StoppedParser.LineNumberGet());
+
+	INFO("Missing file");
+	IniEventRecorder Missing;
+	net::derpaul::yaip::IniEventParser MissingParser(Missing);
+	REQUIRE(!MissingParser.ParseFile("does_not_exist.ini"));
+	REQUIRE(Missing.Events.empty());
+}
+
+#endif // _TEST_INIEVENTPARSER_H_
@@ -0,0 +1,233 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+
+#ifndef _TEST_INIMEMORYRESOURCE_H_
+#define _TEST_INIMEMORYRESOURCE_H_
+
+#include "catch2/catch.hpp"
+#include "IniArena.h"
+#include "YAIP.h"
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+
+/**
+ * Resource on top of the global heap counting the memory in use
+ */
+class CountingResource : public net::derpaul::yaip::IniHeapResource
+{
+public:
+	size_t Allocations = 0;
+	size_t Bytes = 0;
+
+	virtual void *Allocate(size_t Size, size_t Alignment) override
+	{
+		++Allocations;
+		Bytes += Size;
+		return net::derpaul::yaip::IniHeapResource::Allocate(Size, Alignment);
+	}
+
+	virtual void Deallocate(void *Memory, size_t Size, size_t Alignment) override
+	{
+		--Allocations;
+		Bytes -= Size;
+		net::derpaul::yaip::IniHeapResource::Deallocate(Memory, Size, Alignment);
+	}
+};
+
+/**
+ * Resource on top of the global heap counting allocations of other threads
+ */
+class ThreadResource : public net::derpaul::yaip::IniHeapResource
+{
+public:
+	std::thread::id Owner = std::this_thread::get_id();
+	std::atomic<size_t> Foreign{ 0 };
+
+	virtual void *Allocate(size_t Size, size_t Alignment) override
+	{
+		if (std::this_thread::get_id() != Owner)
+		{
+			++Foreign;
+		}
+		return net::derpaul::yaip::IniHeapResource::Allocate(Size, Alignment);
+	}
+};
+
+SCENARIO("Test class IniMemoryResource", "[IniMemoryResource]")
+{
+	GIVEN("The default resource")
+	{
+		const net::derpaul::yaip::IniMemoryResourcePtr &sut = net::derpaul::yaip::IniMemoryResource::DefaultGet();
+		REQUIRE(nullptr != sut);
+
+		THEN("Over aligned memory is aligned")
+		{
+			void *Memory = sut->Allocate(100, 256);
+			REQUIRE(0 == (reinterpret_cast<uintptr_t>(Memory) % 256));
+			sut->Deallocate(Memory, 100, 256);
+		}
+
+		THEN("All heap resources are equal")
+		{
+			net::derpaul::yaip::IniHeapResource Other;
+			REQUIRE(sut->IsEqual(Other));
+			net::derpaul::yaip::IniArena Arena(1024);
+			REQUIRE(!sut->IsEqual(Arena));
+		}
+	}
+
+	GIVEN("An arena on top of a counting resource")
+	{
+		auto Upstream = std::make_shared<CountingResource>();
+		{
+			net::derpaul::yaip::IniArena sut(1024, Upstream);
+			sut.Allocate(16, 8);
+			sut.Allocate(4096, 8);
+			REQUIRE(2 == Upstream->Allocations);
+		}
+
+		THEN("The blocks are returned to the upstream")
+		{
+			REQUIRE(0 == Upstream->Allocations);
+			REQUIRE(0 == Upstream->Bytes);
+		}
+	}
+
+	GIVEN("An entry on top of a counting resource")
+	{
+		auto Resource = std::make_shared<CountingResource>();
+		net::derpaul::yaip::IniEntryPtr sut = net::derpaul::yaip::IniCreate<net::derpaul::yaip::IniEntry>(Resource, Resource);
+		size_t Allocations = Resource->Allocations;
+		sut->ElementValueSet("a value which is too long for the small string optimization");
+
+		THEN("Long strings come from the resource, copies use the global heap")
+		{
+			REQUIRE(Allocations + 1 == Resource->Allocations);
+			net::derpaul::yaip::IniEntry Copy(*sut);
+			REQUIRE(Allocations + 1 == Resource->Allocations);
+			REQUIRE(sut->ElementValueGet() == Copy.ElementValueGet());
+		}
+	}
+
+	GIVEN("A pool on top of a counting resource")
+	{
+		auto Upstream = std::make_shared<CountingResource>();
+		{
+			net::derpaul::yaip::IniStringPool sut(Upstream);
+			sut.Intern("key");
+			REQUIRE(0 < Upstream->Allocations);
+		}
+
+		THEN("Characters and index are returned to the upstream")
+		{
+			REQUIRE(0 == Upstream->Allocations);
+			REQUIRE(0 == Upstream->Bytes);
+		}
+	}
+
+	GIVEN("A list on top of a counting resource")
+	{
+		auto Resource = std::make_shared<CountingResource>();
+		net::derpaul::yaip::IniEntryList sut(Resource);
+		net::derpaul::yaip::IniEntryPtr Entry = net::derpaul::yaip::IniCreate<net::derpaul::yaip::IniEntry>(Resource);
+		Entry->ElementIdentifierSet("key");
+		sut.ElementAdd(Entry);
+		REQUIRE(Resource == sut.ResourceGet());
+		size_t Allocations = Resource->Allocations;
+		REQUIRE(3 <= Allocations);
+
+		WHEN("The list moves to the global heap")
+		{
+			sut.ResourceSet(nullptr);
+
+			THEN("Only the element stays in the resource")
+			{
+				REQUIRE(1 == Resource->Allocations);
+				REQUIRE(net::derpaul::yaip::IniMemoryResource::DefaultGet() == sut.ResourceGet());
+				REQUIRE(Entry == sut.ElementFind("key"));
+			}
+		}
+	}
+}
+
+TEST_CASE("Test memory resource of YAIP", "[YAIP]")
+{
+	const std::string Filename = "yaip_resource.ini";
+	{
+		std::ofstream IniFile(Filename);
+		IniFile << "[Server]\nport = 80\nhost = localhost\n[Client]\nretries = 3\n";
+	}
+
+	auto Resource = std::make_shared<CountingResource>();
+	{
+		net::derpaul::yaip::YAIP sut;
+		REQUIRE(nullptr == sut.MemoryResourceGet());
+		sut.MemoryResourceSet(Resource);
+		REQUIRE(Resource == sut.MemoryResourceGet());
+		REQUIRE(!sut.ArenaEnabled());
+
+		INFO("Sections, entries and their lists come from the resource");
+		REQUIRE(sut.INIFileLoad(Filename));
+		REQUIRE(80 == sut.SectionKeyValueGet("Server", "port", 0));
+		REQUIRE(5 <= Resource->Allocations);
+		size_t Allocations = Resource->Allocations;
+		REQUIRE(sut.SectionKeyValueSet("Client", "timeout", 30));
+		REQUIRE(Allocations < Resource->Allocations);
+
+		INFO("An arena replaces the resource");
+		sut.ArenaEnable(true);
+		REQUIRE(sut.ArenaEnabled());
+		REQUIRE(Resource != sut.MemoryResourceGet());
+		REQUIRE(30 == sut.SectionKeyValueGet("Client", "timeout", 0));
+		sut.ArenaEnable(false);
+		REQUIRE(nullptr == sut.MemoryResourceGet());
+	}
+
+	INFO("Everything is returned");
+	REQUIRE(0 == Resource->Allocations);
+	REQUIRE(0 == Resource->Bytes);
+
+	INFO("A resource of the user is not shared with parser threads");
+	{
+		std::ofstream IniFile(Filename);
+		for (int Section = 0; Section < 2000; ++Section)
+		{
+			IniFile << "[Section" << Section << "]\n";
+			for (int Key = 0; Key < 10; ++Key)
+			{
+				IniFile << "Key" << Key << " = Value " << Key << "\n";
+			}
+		}
+	}
+	auto Threaded = std::make_shared<ThreadResource>();
+	net::derpaul::yaip::YAIP sut;
+	sut.ThreadCountSet(4);
+	sut.MemoryResourceSet(Threaded);
+	REQUIRE(sut.INIFileLoad(Filename));
+	REQUIRE("Value 3" == sut.SectionKeyValueGet(std::string("Section1999"), std::string("Key3"), std::string()));
+	REQUIRE(0 == Threaded->Foreign);
+
+	net::derpaul::yaip::YAIP::INIFileDelete(Filename);
+}
+
+#endif // _TEST_INIMEMORYRESOURCE_H_
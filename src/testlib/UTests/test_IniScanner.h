@@ -0,0 +1,118 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+#ifndef _TEST_INISCANNER_H_
+#define _TEST_INISCANNER_H_
+
+#include "catch2/catch.hpp"
+#include "IniScanner.h"
+#include "IniSection.h"
+#include <string>
+#include <vector>
+
+void testScan(const std::string &RawData, net::derpaul::yaip::IniLineType Type, const std::string &Identifier, const std::string &Value, const std::string &Comment)
+{
+	INFO("Scan [" + RawData + "]");
+	net::derpaul::yaip::IniLine Line;
+
+	REQUIRE(Type == net::derpaul::yaip::IniScanner::Scan(RawData.data(), RawData.length(), Line));
+	REQUIRE(Identifier == Line.Identifier.to_string());
+	REQUIRE(Value == Line.Value.to_string());
+	REQUIRE(Comment == Line.Comment.to_string());
+}
+
+SCENARIO("Test class IniScanner", "[IniScanner]")
+{
+	using net::derpaul::yaip::IniLineType;
+
+	INFO("Classification of lines");
+	testScan("", IniLineType::Blank, "", "", "");
+	testScan(" \t\r", IniLineType::Blank, "", "", "");
+	testScan("; just a comment\r", IniLineType::Comment, "", "", "just a comment");
+	testScan("  ; key = value", IniLineType::Comment, "", "", "key = value");
+	testScan("[Section]", IniLineType::Section, "Section", "", "");
+	testScan("  [ Section ] ; comment\r", IniLineType::Section, "Section", "", "comment");
+	testScan("[Section] garbage ; no comment", IniLineType::Section, "Section", "", "");
+	testScan("key = value", IniLineType::Entry, "key", "value", "");
+	testScan("  key=value ; comment ; more\r", IniLineType::Entry, "key", "value", "comment ; more");
+	testScan("key = a=b", IniLineType::Entry, "key", "a=b", "");
+	testScan("key = ;comment", IniLineType::Entry, "key", "", "comment");
+	testScan("key", IniLineType::Invalid, "", "", "");
+	testScan("key =", IniLineType::Invalid, "", "", "");
+	testScan("key =;comment", IniLineType::Invalid, "", "", "");
+	testScan("[]", IniLineType::Invalid, "", "", "");
+
+	INFO("Same results as the regular expressions");
+	std::vector<std::string> Entries = {
+		"key = value",
+		"key = value ; comment",
+		"  key  =  value with spaces  ;  comment with spaces  \r",
+		"key = a=b=c ; x=y",
+		"key = ;",
+		"key = ; comment",
+		"=a=b",
+		"==a",
+		"key =",
+		"key=;",
+		"a;b = c",
+		"key = value\n; comment",
+		"[Section] = value",
+		"no entry at all"
+	};
+
+	for (auto const &RawData : Entries)
+	{
+		INFO("Entry [" + RawData + "]");
+		net::derpaul::yaip::IniEntry Scanned;
+		net::derpaul::yaip::IniEntry Matched;
+
+		REQUIRE(Matched.CreateFromRawDataRegEx(RawData) == Scanned.CreateFromRawData(RawData));
+		REQUIRE(Matched.ElementIdentifierGet() == Scanned.ElementIdentifierGet());
+		REQUIRE(Matched.ElementValueGet() == Scanned.ElementValueGet());
+		REQUIRE(Matched.ElementCommentGet() == Scanned.ElementCommentGet());
+	}
+
+	std::vector<std::string> Sections = {
+		"[Section]",
+		"  [  Section  ]  ",
+		"[Section] ; comment",
+		"[Section];comment\r",
+		"[Section] ;",
+		"[Section] x ; comment",
+		"[Sec tion] ; comment ; more",
+		"[[Section]",
+		"[ ]",
+		"[]",
+		"[Section",
+		"key = value"
+	};
+
+	for (auto const &RawData : Sections)
+	{
+		INFO("Section [" + RawData + "]");
+		net::derpaul::yaip::IniSection Scanned;
+		net::derpaul::yaip::IniSection Matched;
+
+		REQUIRE(Matched.CreateFromRawDataRegEx(RawData) == Scanned.CreateFromRawData(RawData));
+		REQUIRE(Matched.ElementIdentifierGet() == Scanned.ElementIdentifierGet());
+		REQUIRE(Matched.ElementCommentGet() == Scanned.ElementCommentGet());
+	}
+}
+
+#endif // _TEST_INISCANNER_H_
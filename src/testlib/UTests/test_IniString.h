@@ -0,0 +1,69 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+
+
+#ifndef _TEST_INISTRING_H_
+#define _TEST_INISTRING_H_
+
+#include "catch2/catch.hpp"
+#include "IniString.h"
+#include <string>
+
+SCENARIO("Test class IniString", "[IniString]")
+{
+	net::derpaul::yaip::IniString sut;
+	REQUIRE(sut.empty());
+	REQUIRE(std::string("") == sut.c_str());
+
+	INFO("Short and long strings are stored");
+	sut.assign("key");
+	REQUIRE("key" == sut);
+	const std::string Long(100, 'x');
+	sut.assign(Long);
+	REQUIRE(Long == sut);
+	REQUIRE(Long.length() == sut.length());
+
+	INFO("A part of the string can be assigned to itself");
+	sut.assign(sut.data() + 90, 10);
+	REQUIRE(std::string(10, 'x') == sut);
+
+	INFO("Shared characters are not copied");
+	const char Owner[] = "shared";
+	sut.Share(Owner, 6, Owner);
+	REQUIRE(sut.data() == Owner);
+	REQUIRE(sut.IsShared());
+	REQUIRE(sut.IsSharedBy(Owner));
+
+	INFO("Copies own their characters, moves take them over");
+	net::derpaul::yaip::IniString Copy(sut);
+	REQUIRE(!Copy.IsShared());
+	REQUIRE("shared" == Copy);
+	net::derpaul::yaip::IniString Moved(std::move(sut));
+	REQUIRE(Moved.data() == Owner);
+	REQUIRE(sut.empty());
+
+	INFO("Assigning to a shared string does not touch the owner");
+	Moved.assign("other");
+	REQUIRE(!Moved.IsShared());
+	REQUIRE(std::string("shared") == Owner);
+	REQUIRE(std::string("other") == static_cast<std::string>(Moved));
+}
+
+#endif // _TEST_INISTRING_H_
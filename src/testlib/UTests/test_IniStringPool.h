@@ -0,0 +1,179 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+
+
+#ifndef _TEST_INISTRINGPOOL_H_
+#define _TEST_INISTRINGPOOL_H_
+
+#include "catch2/catch.hpp"
+#include "IniStringPool.h"
+#include "YAIP.h"
+#include <fstream>
+#include <string>
+
+SCENARIO("Test class IniStringPool", "[IniStringPool]")
+{
+	GIVEN("An empty pool")
+	{
+		net::derpaul::yaip::IniStringPool sut;
+		REQUIRE(0 == sut.SizeGet());
+		REQUIRE(0 == sut.BytesGet());
+		REQUIRE(nullptr == sut.Find("key").data());
+
+		WHEN("Equal strings are interned")
+		{
+			net::derpaul::yaip::tStringView First = sut.Intern("key");
+			net::derpaul::yaip::tStringView Second = sut.Intern(std::string("key"));
+			net::derpaul::yaip::tStringView Other = sut.Intern("value");
+
+			THEN("They share one instance")
+			{
+				REQUIRE(First.data() == Second.data());
+				REQUIRE(First.data() != Other.data());
+				REQUIRE(std::string("key") == First.data());
+				REQUIRE(First.data() == sut.Find("key").data());
+				REQUIRE(2 == sut.SizeGet());
+				REQUIRE(8 == sut.BytesGet());
+			}
+
+			THEN("Only the interned instance is contained")
+			{
+				net::derpaul::yaip::IniString Shared;
+				sut.Intern("key", Shared);
+				REQUIRE(Shared.data() == First.data());
+				REQUIRE(sut.Contains(Shared));
+
+				net::derpaul::yaip::IniString Copy(Shared);
+				REQUIRE("key" == Copy);
+				REQUIRE(!sut.Contains(Copy));
+			}
+		}
+
+		WHEN("Many strings are interned")
+		{
+			net::derpaul::yaip::tStringView First = sut.Intern("key0");
+			for (int Index = 1; Index < 1000; ++Index)
+			{
+				sut.Intern("key" + std::to_string(Index));
+			}
+
+			THEN("The addresses are stable")
+			{
+				REQUIRE(1000 == sut.SizeGet());
+				REQUIRE(First.data() == sut.Intern("key0").data());
+				REQUIRE(std::string("key0") == First.data());
+			}
+		}
+	}
+}
+
+TEST_CASE("Test string interning of YAIP", "[YAIP]")
+{
+	const std::string Filename = "yaip_intern.ini";
+	{
+		std::ofstream IniFile(Filename);
+		IniFile << "[Server]\nport = 80\nenabled = true\n[Client]\nport = 80\nenabled = false\n";
+	}
+
+	net::derpaul::yaip::YAIP sut;
+	REQUIRE(!sut.InternEnabled());
+	REQUIRE(nullptr == sut.StringPoolGet());
+	sut.InternEnable(true);
+	REQUIRE(sut.InternEnabled());
+
+	INFO("An unused pool is kept");
+	net::derpaul::yaip::IniStringPoolPtr Unused = sut.StringPoolGet();
+	sut.Clear();
+	REQUIRE(Unused == sut.StringPoolGet());
+	Unused.reset();
+	REQUIRE(sut.INIFileLoad(Filename));
+
+	net::derpaul::yaip::IniStringPoolPtr Pool = sut.StringPoolGet();
+	REQUIRE(nullptr != Pool);
+	REQUIRE(5 == Pool->SizeGet());
+
+	INFO("Equal keys and values share one string");
+	net::derpaul::yaip::IniEntryPtr Server = sut.SectionListView().ElementFind("Server")->EntryFind("port");
+	net::derpaul::yaip::IniEntryPtr Client = sut.SectionListView().ElementFind("Client")->EntryFind("port");
+	REQUIRE(nullptr != Server);
+	REQUIRE(nullptr != Client);
+	REQUIRE(Server->ElementIdentifierGet().data() == Client->ElementIdentifierGet().data());
+	REQUIRE(Server->ElementValueGet().data() == Client->ElementValueGet().data());
+
+	INFO("Interned keys are found by their ID");
+	net::derpaul::yaip::IniSectionPtr Section = sut.SectionListView().ElementFind("Server");
+	REQUIRE(Server->ElementIdentifierGet().data() == Pool->IdFind(net::derpaul::yaip::strhash("port", 4), "port"));
+	REQUIRE(nullptr == Pool->IdFind(net::derpaul::yaip::strhash("missing", 7), "missing"));
+	REQUIRE(Server == *Section->EntryLookup(" port ", Pool.get()));
+	REQUIRE(nullptr == Section->EntryLookup("missing", Pool.get()));
+
+	INFO("Updates of one entry do not change the other");
+	REQUIRE(sut.SectionKeyValueSet("Server", "port", 8080));
+	REQUIRE(8080 == sut.SectionKeyValueGet("Server", "port", 0));
+	REQUIRE(80 == sut.SectionKeyValueGet("Client", "port", 0));
+	REQUIRE(sut.SectionKeyValueSet("Client", "timeout", 30));
+	REQUIRE(30 == sut.SectionKeyValueGet("Client", "timeout", 0));
+
+	INFO("Only new keys are interned, written values are not");
+	REQUIRE(6 == Pool->SizeGet());
+	REQUIRE(!Pool->Contains(Server->ElementValueGet()));
+	REQUIRE(Pool->Contains(Client->ElementValueGet()));
+
+	INFO("Values written by a handle are not interned either");
+	net::derpaul::yaip::IniEntryPtr Enabled = sut.SectionListView().ElementFind("Client")->EntryFind("enabled");
+	REQUIRE(Pool->Contains(Enabled->ElementValueGet()));
+	net::derpaul::yaip::IniKeyHandle Handle = sut.KeyHandleGet("Client", "enabled");
+	REQUIRE(Handle.ValueSet(false));
+	REQUIRE(!sut.SectionKeyValueGet("Client", "enabled", true));
+	REQUIRE(!Pool->Contains(Enabled->ElementValueGet()));
+	REQUIRE(6 == Pool->SizeGet());
+	Enabled.reset();
+
+	INFO("A transaction interns only new keys as well");
+	net::derpaul::yaip::IniTransaction Transaction = sut.TransactionBegin();
+	Transaction.SectionKeyValueSet("Server", "retries", 3);
+	Transaction.SectionKeyValueSet("Server", "enabled", false);
+	REQUIRE(Transaction.Commit());
+	REQUIRE(7 == Pool->SizeGet());
+	net::derpaul::yaip::IniEntryPtr Retries = sut.SectionListView().ElementFind("Server")->EntryFind("retries");
+	REQUIRE(Pool->Contains(Retries->ElementIdentifierGet()));
+	REQUIRE(!Pool->Contains(Retries->ElementValueGet()));
+	REQUIRE(!sut.SectionKeyValueGet("Server", "enabled", true));
+	Retries.reset();
+
+	INFO("Snapshots own their strings");
+	sut.SnapshotPublish();
+	net::derpaul::yaip::IniSnapshotPtr Snapshot = sut.SnapshotGet();
+	sut.InternEnable(false);
+	Pool.reset();
+	REQUIRE(8080 == Snapshot->SectionKeyValueGet("Server", "port", 0));
+	REQUIRE(80 == sut.SectionKeyValueGet("Client", "port", 0));
+
+	INFO("A saved file is unchanged");
+	REQUIRE(sut.INIFileSave(Filename));
+	net::derpaul::yaip::YAIP Reloaded;
+	REQUIRE(Reloaded.INIFileLoad(Filename));
+	REQUIRE(8080 == Reloaded.SectionKeyValueGet("Server", "port", 0));
+	REQUIRE("false" == Reloaded.SectionKeyValueGet("Client", "enabled", std::string()));
+
+	net::derpaul::yaip::YAIP::INIFileDelete(Filename);
+}
+
+#endif // _TEST_INISTRINGPOOL_H_
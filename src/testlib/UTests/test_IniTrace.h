@@ -0,0 +1,95 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+
+#ifndef _TEST_INITRACE_H_
+#define _TEST_INITRACE_H_
+
+#include "catch2/catch.hpp"
+#include "IniTrace.h"
+#include <string>
+
+SCENARIO("Test class IniTrace", "[IniTrace]")
+{
+	GIVEN("A trace with room for two spans")
+	{
+		net::derpaul::yaip::IniTrace sut(2);
+		REQUIRE(2 == sut.CapacityGet());
+		REQUIRE(sut.EventsGet().empty());
+
+		WHEN("Three spans are recorded")
+		{
+			{
+				net::derpaul::yaip::IniTraceSpan Span(&sut, "first");
+			}
+			{
+				net::derpaul::yaip::IniTraceSpan Span(&sut, "second");
+				Span.ArgAdd("lines", 42);
+			}
+			{
+				net::derpaul::yaip::IniTraceSpan Span(&sut, "third");
+			}
+
+			THEN("The oldest span is overwritten")
+			{
+				auto Events = sut.EventsGet();
+				REQUIRE(2 == Events.size());
+				REQUIRE(std::string("second") == Events[0].Name);
+				REQUIRE(std::string("third") == Events[1].Name);
+				REQUIRE(1 == Events[0].ArgCount);
+				REQUIRE(42 == Events[0].Args[0].Value);
+				REQUIRE(Events[0].Start <= Events[1].Start);
+				REQUIRE(1 == sut.DroppedGet());
+			}
+
+			THEN("The spans are exported as complete events")
+			{
+				std::string Json;
+				sut.ChromeJsonWrite(Json);
+				REQUIRE(0 == Json.find("{\"traceEvents\":["));
+				REQUIRE(std::string::npos == Json.find("\"first\""));
+				REQUIRE(std::string::npos != Json.find("{\"name\":\"second\",\"cat\":\"yaip\",\"ph\":\"X\",\"ts\":"));
+				REQUIRE(std::string::npos != Json.find("\"args\":{\"lines\":42}"));
+				REQUIRE(std::string::npos != Json.find("\"displayTimeUnit\":\"ns\"}"));
+			}
+
+			THEN("Clear removes all spans")
+			{
+				sut.Clear();
+				REQUIRE(sut.EventsGet().empty());
+				REQUIRE(0 == sut.DroppedGet());
+			}
+		}
+
+		WHEN("A span has no trace")
+		{
+			{
+				net::derpaul::yaip::IniTraceSpan Span(nullptr, "ignored");
+				Span.ArgAdd("lines", 1);
+			}
+
+			THEN("Nothing is recorded")
+			{
+				REQUIRE(sut.EventsGet().empty());
+			}
+		}
+	}
+}
+
+#endif // _TEST_INITRACE_H_
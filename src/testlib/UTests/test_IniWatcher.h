@@ -0,0 +1,119 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+#ifndef _TEST_INIWATCHER_H_
+#define _TEST_INIWATCHER_H_
+
+#include "catch2/catch.hpp"
+#include "IniWatcher.h"
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+
+static void WatchedFileWrite(const std::string &Filename, const std::string &Value)
+{
+	std::ofstream IniFile(Filename, std::ios::out | std::ios::trunc);
+	IniFile << "[Section]\nkey = " << Value << "\n";
+}
+
+static bool WatchedReloadWait(const net::derpaul::yaip::IniWatcher &Watcher, size_t Count)
+{
+	for (int Loop = 0; (Loop < 500) && (Watcher.ReloadCountGet() < Count); ++Loop)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	return Watcher.ReloadCountGet() >= Count;
+}
+
+SCENARIO("Test class IniWatcher", "[IniWatcher]")
+{
+	const std::string Filename = "yaip_watched.ini";
+	WatchedFileWrite(Filename, "initial");
+
+	net::derpaul::yaip::IniWatcher Watcher;
+	REQUIRE(net::derpaul::yaip::IniWatcher::DefaultDebounce == Watcher.DebounceGet());
+	Watcher.DebounceSet(50);
+	REQUIRE(nullptr == Watcher.SnapshotGet());
+	REQUIRE(net::derpaul::yaip::IniLoadMode::Stream == Watcher.LoaderGet().LoadModeGet());
+
+	std::atomic<int> Callbacks(0);
+	std::string CallbackValue;
+	REQUIRE(Watcher.Start(Filename, [&](const net::derpaul::yaip::IniSnapshotPtr &Snapshot)
+	{
+		CallbackValue = Snapshot->SectionKeyValueGet("Section", "key", std::string(""));
+		++Callbacks;
+	}));
+	REQUIRE(Watcher.Running());
+
+	INFO("Initial load is published without callback");
+	net::derpaul::yaip::IniSnapshotPtr Initial = Watcher.SnapshotGet();
+	REQUIRE(nullptr != Initial);
+	REQUIRE(std::string("initial") == Initial->SectionKeyValueGet("Section", "key", std::string("")));
+	REQUIRE(0 == Callbacks);
+
+	INFO("Burst of writes is reloaded after the debounce time");
+	const int Writes = 10;
+	for (int Loop = 0; Loop < Writes; ++Loop)
+	{
+		WatchedFileWrite(Filename, "value" + std::to_string(Loop));
+	}
+	REQUIRE(WatchedReloadWait(Watcher, 1));
+	std::this_thread::sleep_for(std::chrono::milliseconds(200));
+	REQUIRE(Writes > Watcher.ReloadCountGet());
+	REQUIRE(std::string("value9") == Watcher.SnapshotGet()->SectionKeyValueGet("Section", "key", std::string("")));
+
+	INFO("Old snapshot is untouched");
+	REQUIRE(std::string("initial") == Initial->SectionKeyValueGet("Section", "key", std::string("")));
+
+	INFO("Replaced file is detected");
+	size_t Reloads = Watcher.ReloadCountGet();
+	WatchedFileWrite(Filename + ".new", "replaced");
+	REQUIRE(0 == rename((Filename + ".new").c_str(), Filename.c_str()));
+	REQUIRE(WatchedReloadWait(Watcher, Reloads + 1));
+	REQUIRE(std::string("replaced") == Watcher.SnapshotGet()->SectionKeyValueGet("Section", "key", std::string("")));
+
+	INFO("Writes of other files in the directory do not delay the reload");
+	const std::string Sibling = "yaip_watched.log";
+	Reloads = Watcher.ReloadCountGet();
+	WatchedFileWrite(Filename, "sibling");
+	for (int Loop = 0; (Loop < 100) && (Reloads == Watcher.ReloadCountGet()); ++Loop)
+	{
+		WatchedFileWrite(Sibling, std::to_string(Loop));
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	REQUIRE(Reloads < Watcher.ReloadCountGet());
+	REQUIRE(std::string("sibling") == Watcher.SnapshotGet()->SectionKeyValueGet("Section", "key", std::string("")));
+	net::derpaul::yaip::YAIP::INIFileDelete(Sibling);
+
+	INFO("Callback is invoked after the swap");
+	Watcher.Stop();
+	REQUIRE(!Watcher.Running());
+	REQUIRE(static_cast<int>(Watcher.ReloadCountGet()) == Callbacks);
+	REQUIRE(std::string("sibling") == CallbackValue);
+
+	INFO("Missing file cannot be watched");
+	net::derpaul::yaip::YAIP::INIFileDelete(Filename);
+	REQUIRE(!Watcher.Start(Filename, nullptr));
+	REQUIRE(!Watcher.Running());
+	REQUIRE(nullptr != Watcher.SnapshotGet());
+}
+
+#endif // _TEST_INIWATCHER_H_
@@ -0,0 +1,69 @@
+//******************************************************************************
+// Copyright 2016 ThirtySomething
+//******************************************************************************
+// This file is part of YAIP.
+//
+// YAIP is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// YAIP is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for
+// more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with YAIP. If not, see <http://www.gnu.org/licenses/>.
+//******************************************************************************
+
+#ifndef _TEST_INIWRITER_H_
+#define _TEST_INIWRITER_H_
+
+#include "catch2/catch.hpp"
+#include "IniSection.h"
+#include "IniWriter.h"
+#include <sstream>
+#include <string>
+
+SCENARIO("Test class IniWriter", "[IniWriter]")
+{
+	net::derpaul::yaip::IniSection Section;
+	REQUIRE(Section.CreateFromRawData("[Section] ; comment"));
+	REQUIRE(Section.AddRawEntry("key1 = value1 ; comment1"));
+	REQUIRE(Section.AddRawEntry("key2 = value2"));
+	const std::string Expected = "[Section] ; comment\nkey1 = value1 ; comment1\nkey2 = value2\n\n";
+	REQUIRE(Expected == Section.to_string());
+
+	INFO("Own buffer keeps everything");
+	net::derpaul::yaip::IniWriter Collect;
+	Section.Write(Collect);
+	Section.Write(Collect);
+	REQUIRE(Expected + Expected == Collect.BufferGet());
+	REQUIRE(Collect.Flush());
+
+	INFO("Buffer of the caller is appended to");
+	std::string Buffer = "; header\n";
+	{
+		net::derpaul::yaip::IniWriter Append(Buffer);
+		Section.Write(Append);
+	}
+	REQUIRE("; header\n" + Expected == Buffer);
+
+	INFO("Stream gets the data in chunks");
+	std::ostringstream Stream;
+	std::string Content;
+	{
+		net::derpaul::yaip::IniWriter Chunked(Stream);
+		for (size_t Loop = 0; Loop < 2 * net::derpaul::yaip::IniWriter::DefaultChunkSize / Expected.length(); ++Loop)
+		{
+			Section.Write(Chunked);
+			Content += Expected;
+		}
+		REQUIRE(Chunked.BufferGet().length() < net::derpaul::yaip::IniWriter::DefaultChunkSize);
+		REQUIRE(!Stream.str().empty());
+	}
+	REQUIRE(Content == Stream.str());
+}
+
+#endif // _TEST_INIWRITER_H_
@@ -21,7 +21,16 @@
 #include "catch2/catch.hpp"
 
 #include "UTests/test_Convert.h"
+#include "UTests/test_IniArena.h"
 #include "UTests/test_IniEntry.h"
 #include "UTests/test_IniEntryList.h"
+#include "UTests/test_IniEventParser.h"
+#include "UTests/test_IniMemoryResource.h"
+#include "UTests/test_IniScanner.h"
 #include "UTests/test_IniSection.h"
+#include "UTests/test_IniString.h"
+#include "UTests/test_IniStringPool.h"
+#include "UTests/test_IniTrace.h"
+#include "UTests/test_IniWatcher.h"
+#include "UTests/test_IniWriter.h"
 #include "ITests/test_YAIP.h"